@@ -9,6 +9,7 @@
       'type': 'none',
       'dependencies': [
         '../src/d8.gyp:d8',
+        '../tools/binary-tickprocessor.gyp:binary-tickprocessor',
       ],
       'conditions': [
         ['component!="shared_library"', {
@@ -488,6 +488,44 @@ class V8_EXPORT AllocationProfile {
     unsigned int count;
   };
 
+  /**
+   * Sampled allocations that are still alive, bucketed by the type of the
+   * allocated object and by the number of garbage collections they have
+   * survived since they were sampled.
+   */
+  struct RetainedAllocation {
+    /**
+     * Name of the instance type of the sampled objects, e.g. JS_OBJECT_TYPE.
+     */
+    Local<String> instance_type;
+
+    /**
+     * Name of the constructor of the sampled objects. Empty if the objects
+     * are not JavaScript objects or the constructor is anonymous.
+     */
+    Local<String> constructor_name;
+
+    /**
+     * Size of the sampled allocation object.
+     */
+    size_t size;
+
+    /**
+     * The estimated number of objects of this kind that are alive.
+     */
+    unsigned int count;
+
+    /**
+     * The number of scavenges the objects have survived.
+     */
+    unsigned int scavenges_survived;
+
+    /**
+     * The number of mark-compacts the objects have survived.
+     */
+    unsigned int mark_compacts_survived;
+  };
+
   /**
    * Represents a node in the call-graph.
    */
@@ -538,6 +576,13 @@ class V8_EXPORT AllocationProfile {
      * List of self allocations done by this node in the call-graph.
      */
     std::vector<Allocation> allocations;
+
+    /**
+     * The self allocations of this node broken down by object type and
+     * survival count. Up to rounding of the estimated counts, these add up to
+     * |allocations|.
+     */
+    std::vector<RetainedAllocation> retained_allocations;
   };
 
   /**
@@ -547,6 +592,14 @@ class V8_EXPORT AllocationProfile {
    */
   virtual Node* GetRootNode() = 0;
 
+  /**
+   * Returns the estimated number of bytes allocated directly by |node| that
+   * are still alive and have survived at least |min_gcs| garbage collections,
+   * counting both scavenges and mark-compacts. Allocation sites with a
+   * growing number of such bytes are likely to be leaking.
+   */
+  static size_t GetSurvivingSize(const Node* node, unsigned int min_gcs);
+
   virtual ~AllocationProfile() {}
 
   static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
@@ -5326,6 +5326,64 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * A snapshot of the runtime statistics of an isolate, see
+ * Isolate::GetRuntimeStatistics. Only entries with a non-zero count are
+ * included.
+ */
+class V8_EXPORT RuntimeStatistics {
+ public:
+  struct Entry {
+    /**
+     * Name of the counter. The string is statically allocated.
+     */
+    const char* name;
+
+    /**
+     * Number of events counted.
+     */
+    int64_t count;
+
+    /**
+     * Accumulated time spent in the events, in microseconds. Zero for
+     * counters that do not measure time.
+     */
+    int64_t time_in_us;
+  };
+
+  RuntimeStatistics() {}
+
+  /**
+   * Time spent in runtime functions, C++ builtins, API functions and IC
+   * handlers. Only collected when V8 runs with --runtime-call-stats.
+   */
+  const std::vector<Entry>& runtime_calls() const { return runtime_calls_; }
+
+  /**
+   * Number of inline cache misses by IC kind, e.g. LOAD_IC or CALL_IC.
+   */
+  const std::vector<Entry>& ic_misses() const { return ic_misses_; }
+
+  /**
+   * Number of deoptimizations of optimized code by deoptimization reason.
+   */
+  const std::vector<Entry>& deopts() const { return deopts_; }
+
+  /**
+   * Number of compilations and time spent compiling by compiler tier, i.e.
+   * Ignition, FullCodegen, Crankshaft and TurboFan.
+   */
+  const std::vector<Entry>& compiles() const { return compiles_; }
+
+ private:
+  std::vector<Entry> runtime_calls_;
+  std::vector<Entry> ic_misses_;
+  std::vector<Entry> deopts_;
+  std::vector<Entry> compiles_;
+
+  friend class Isolate;
+};
+
 class RetainedObjectInfo;
 
 
@@ -5901,6 +5959,20 @@ class V8_EXPORT Isolate {
    */
   bool GetHeapCodeAndMetadataStatistics(HeapCodeStatistics* object_statistics);
 
+  /**
+   * Get the runtime call, IC miss, deoptimization and compilation statistics
+   * collected since the isolate was created or since the last call to
+   * ResetRuntimeStatistics. This is cheap enough to be polled periodically.
+   *
+   * \param statistics The RuntimeStatistics object to fill in.
+   */
+  void GetRuntimeStatistics(RuntimeStatistics* statistics);
+
+  /**
+   * Resets all counters reported by GetRuntimeStatistics to zero.
+   */
+  void ResetRuntimeStatistics();
+
   /**
    * Get a call stack sample from the isolate.
    * \param state Execution state.
@@ -7701,6 +7701,54 @@ bool Isolate::GetHeapCodeAndMetadataStatistics(
   return true;
 }
 
+void Isolate::GetRuntimeStatistics(RuntimeStatistics* statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Counters* counters = isolate->counters();
+
+  statistics->runtime_calls_.clear();
+  std::vector<i::RuntimeCallCounter*> runtime_calls;
+  counters->runtime_call_stats()->CollectCounters(&runtime_calls);
+  for (i::RuntimeCallCounter* counter : runtime_calls) {
+    statistics->runtime_calls_.push_back(
+        {counter->name, counter->count, counter->time.InMicroseconds()});
+  }
+
+  i::RuntimeEventCounters* events = counters->runtime_event_counters();
+  statistics->ic_misses_.clear();
+  for (int i = 0; i < i::Code::NUMBER_OF_KINDS; i++) {
+    i::Code::Kind kind = static_cast<i::Code::Kind>(i);
+    if (events->ic_misses(kind) == 0) continue;
+    statistics->ic_misses_.push_back(
+        {i::Code::Kind2String(kind), events->ic_misses(kind), 0});
+  }
+
+  statistics->deopts_.clear();
+  for (int i = 0; i < i::RuntimeEventCounters::kDeoptimizeReasonCount; i++) {
+    i::DeoptimizeReason reason = static_cast<i::DeoptimizeReason>(i);
+    if (events->deopts(reason) == 0) continue;
+    statistics->deopts_.push_back(
+        {i::DeoptimizeReasonToString(reason), events->deopts(reason), 0});
+  }
+
+  statistics->compiles_.clear();
+  for (int i = 0; i < i::RuntimeEventCounters::kCompilerTierCount; i++) {
+    i::RuntimeEventCounters::CompilerTier tier =
+        static_cast<i::RuntimeEventCounters::CompilerTier>(i);
+    const i::RuntimeEventCounters::CompileCounter& compiles =
+        events->compiles(tier);
+    if (compiles.count == 0) continue;
+    statistics->compiles_.push_back(
+        {i::RuntimeEventCounters::CompilerTierToString(tier), compiles.count,
+         compiles.time.InMicroseconds()});
+  }
+}
+
+void Isolate::ResetRuntimeStatistics() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->counters()->runtime_call_stats()->Reset();
+  isolate->counters()->runtime_event_counters()->Reset();
+}
+
 void Isolate::GetStackSample(const RegisterState& state, void** frames,
                              size_t frames_limit, SampleInfo* sample_info) {
 #if defined(USE_SIMULATOR)
@@ -8778,6 +8826,18 @@ AllocationProfile* HeapProfiler::GetAllocationProfile() {
 }
 
 
+size_t AllocationProfile::GetSurvivingSize(const Node* node,
+                                           unsigned int min_gcs) {
+  size_t result = 0;
+  for (const RetainedAllocation& allocation : node->retained_allocations) {
+    unsigned int gcs =
+        allocation.scavenges_survived + allocation.mark_compacts_survived;
+    if (gcs >= min_gcs) result += allocation.size * allocation.count;
+  }
+  return result;
+}
+
+
 void HeapProfiler::DeleteAllHeapSnapshots() {
   reinterpret_cast<i::HeapProfiler*>(this)->DeleteAllSnapshots();
 }
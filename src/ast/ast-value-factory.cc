@@ -28,6 +28,7 @@
 #include "src/ast/ast-value-factory.h"
 
 #include "src/api.h"
+#include "src/objects-inl.h"
 #include "src/objects.h"
 #include "src/utils.h"
 
@@ -58,6 +59,7 @@ class AstRawStringInternalizationKey : public HashTableKey {
       : string_(string) {}
 
   bool IsMatch(Object* other) override {
+    if (!String::cast(other)->HashFieldMatches(string_->hash())) return false;
     if (string_->is_one_byte_)
       return String::cast(other)->IsOneByteEqualTo(string_->literal_bytes_);
     return String::cast(other)->IsTwoByteEqualTo(
@@ -10,26 +10,139 @@
 #include <malloc.h>  // NOLINT
 #endif
 
+#include "src/base/bits.h"
+#include "src/base/logging.h"
+
+#ifdef V8_USE_ADDRESS_SANITIZER
+#include <sanitizer/asan_interface.h>
+#else
+#define ASAN_POISON_MEMORY_REGION(start, size) \
+  do {                                         \
+    USE(start);                                \
+    USE(size);                                 \
+  } while (false)
+
+#define ASAN_UNPOISON_MEMORY_REGION(start, size) \
+  do {                                           \
+    USE(start);                                  \
+    USE(size);                                   \
+  } while (false)
+#endif  // V8_USE_ADDRESS_SANITIZER
+
 namespace v8 {
 namespace base {
 
+AccountingAllocator::AccountingAllocator() {
+  for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+    pool_heads_[i] = nullptr;
+    pool_counts_[i] = 0;
+    pool_max_counts_[i] = 0;
+  }
+}
+
+AccountingAllocator::~AccountingAllocator() { ClearSegmentPool(); }
+
 void* AccountingAllocator::Allocate(size_t bytes) {
   void* memory = malloc(bytes);
-  if (memory) {
-    AtomicWord current =
-        NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
-    AtomicWord max = NoBarrier_Load(&max_memory_usage_);
-    while (current > max) {
-      max = NoBarrier_CompareAndSwap(&max_memory_usage_, max, current);
-    }
-  }
+  if (memory) IncreaseMemoryUsage(bytes);
   return memory;
 }
 
 void AccountingAllocator::Free(void* memory, size_t bytes) {
   free(memory);
-  NoBarrier_AtomicIncrement(&current_memory_usage_,
-                            -static_cast<AtomicWord>(bytes));
+  DecreaseMemoryUsage(bytes);
+}
+
+void* AccountingAllocator::GetSegment(size_t bytes) {
+  if (IsPooledSegmentSize(bytes)) {
+    size_t bucket = PoolBucketFor(bytes);
+    PooledSegment* segment = nullptr;
+    {
+      LockGuard<Mutex> guard(&pool_mutex_);
+      segment = pool_heads_[bucket];
+      if (segment != nullptr) {
+        pool_heads_[bucket] = segment->next;
+        pool_counts_[bucket]--;
+      }
+    }
+    if (segment != nullptr) {
+      ASAN_UNPOISON_MEMORY_REGION(segment, bytes);
+      NoBarrier_AtomicIncrement(&current_pool_size_,
+                                -static_cast<AtomicWord>(bytes));
+      IncreaseMemoryUsage(bytes);
+      OnSegmentReused(bytes);
+      return segment;
+    }
+  }
+  return Allocate(bytes);
+}
+
+void AccountingAllocator::ReturnSegment(void* memory, size_t bytes) {
+  if (IsPooledSegmentSize(bytes)) {
+    size_t bucket = PoolBucketFor(bytes);
+    bool pooled = false;
+    {
+      LockGuard<Mutex> guard(&pool_mutex_);
+      if (pool_counts_[bucket] < pool_max_counts_[bucket]) {
+        PooledSegment* segment = reinterpret_cast<PooledSegment*>(memory);
+        segment->next = pool_heads_[bucket];
+        pool_heads_[bucket] = segment;
+        pool_counts_[bucket]++;
+        // Catch uses of the segment after the zone that owned it is gone.
+        // The link to the next pooled segment stays accessible.
+        ASAN_POISON_MEMORY_REGION(segment + 1, bytes - sizeof(PooledSegment));
+        pooled = true;
+      }
+    }
+    if (pooled) {
+      NoBarrier_AtomicIncrement(&current_pool_size_, bytes);
+      DecreaseMemoryUsage(bytes);
+      OnSegmentPooled(bytes);
+      return;
+    }
+  }
+  Free(memory, bytes);
+}
+
+void AccountingAllocator::ConfigureSegmentPool(size_t max_pool_size) {
+  PooledSegment* trimmed[kNumberOfPoolBuckets];
+  {
+    LockGuard<Mutex> guard(&pool_mutex_);
+    size_t bucket_size = max_pool_size / kNumberOfPoolBuckets;
+    for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+      pool_max_counts_[i] = bucket_size >> (kMinPooledSegmentSizeLog2 + i);
+      trimmed[i] = TrimPoolBucket(i, pool_max_counts_[i]);
+    }
+  }
+  for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+    FreePooledSegments(trimmed[i], i);
+  }
+}
+
+void AccountingAllocator::DecaySegmentPool() {
+  PooledSegment* trimmed[kNumberOfPoolBuckets];
+  {
+    LockGuard<Mutex> guard(&pool_mutex_);
+    for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+      trimmed[i] = TrimPoolBucket(i, pool_counts_[i] / 2);
+    }
+  }
+  for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+    FreePooledSegments(trimmed[i], i);
+  }
+}
+
+void AccountingAllocator::ClearSegmentPool() {
+  PooledSegment* trimmed[kNumberOfPoolBuckets];
+  {
+    LockGuard<Mutex> guard(&pool_mutex_);
+    for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+      trimmed[i] = TrimPoolBucket(i, 0);
+    }
+  }
+  for (size_t i = 0; i < kNumberOfPoolBuckets; ++i) {
+    FreePooledSegments(trimmed[i], i);
+  }
 }
 
 size_t AccountingAllocator::GetCurrentMemoryUsage() const {
@@ -40,5 +153,63 @@ size_t AccountingAllocator::GetMaxMemoryUsage() const {
   return NoBarrier_Load(&max_memory_usage_);
 }
 
+size_t AccountingAllocator::GetCurrentPoolSize() const {
+  return NoBarrier_Load(&current_pool_size_);
+}
+
+// static
+bool AccountingAllocator::IsPooledSegmentSize(size_t bytes) {
+  return bytes >= kMinPooledSegmentSize && bytes <= kMaxPooledSegmentSize &&
+         bits::IsPowerOfTwo64(bytes);
+}
+
+// static
+size_t AccountingAllocator::PoolBucketFor(size_t bytes) {
+  DCHECK(IsPooledSegmentSize(bytes));
+  return bits::CountTrailingZeros64(bytes) - kMinPooledSegmentSizeLog2;
+}
+
+void AccountingAllocator::IncreaseMemoryUsage(size_t bytes) {
+  AtomicWord current = NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
+  AtomicWord max = NoBarrier_Load(&max_memory_usage_);
+  while (current > max) {
+    max = NoBarrier_CompareAndSwap(&max_memory_usage_, max, current);
+  }
+}
+
+void AccountingAllocator::DecreaseMemoryUsage(size_t bytes) {
+  NoBarrier_AtomicIncrement(&current_memory_usage_,
+                            -static_cast<AtomicWord>(bytes));
+}
+
+AccountingAllocator::PooledSegment* AccountingAllocator::TrimPoolBucket(
+    size_t bucket, size_t keep) {
+  PooledSegment* trimmed = nullptr;
+  while (pool_counts_[bucket] > keep) {
+    PooledSegment* segment = pool_heads_[bucket];
+    pool_heads_[bucket] = segment->next;
+    pool_counts_[bucket]--;
+    segment->next = trimmed;
+    trimmed = segment;
+  }
+  return trimmed;
+}
+
+void AccountingAllocator::FreePooledSegments(PooledSegment* segments,
+                                             size_t bucket) {
+  size_t bytes = kMinPooledSegmentSize << bucket;
+  while (segments != nullptr) {
+    PooledSegment* segment = segments;
+    segments = segment->next;
+    ASAN_UNPOISON_MEMORY_REGION(segment, bytes);
+    NoBarrier_AtomicIncrement(&current_pool_size_,
+                              -static_cast<AtomicWord>(bytes));
+    // The segment left the memory usage when it was pooled, and Free() is
+    // about to subtract it once more. The high-water mark stays as it is.
+    NoBarrier_AtomicIncrement(&current_memory_usage_, bytes);
+    Free(segment, bytes);
+  }
+}
+
 }  // namespace base
 }  // namespace v8
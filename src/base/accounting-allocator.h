@@ -7,25 +7,91 @@
 
 #include "src/base/atomicops.h"
 #include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
 
 namespace v8 {
 namespace base {
 
 class AccountingAllocator {
  public:
-  AccountingAllocator() = default;
-  virtual ~AccountingAllocator() = default;
+  // Sizes of the segments that are kept in the segment pool. Segments of other
+  // sizes are always returned to the system right away.
+  static const size_t kMinPooledSegmentSizeLog2 = 13;  // 8 KB
+  static const size_t kMaxPooledSegmentSizeLog2 = 20;  // 1 MB
+  static const size_t kMinPooledSegmentSize = size_t{1}
+                                              << kMinPooledSegmentSizeLog2;
+  static const size_t kMaxPooledSegmentSize = size_t{1}
+                                              << kMaxPooledSegmentSizeLog2;
+  static const size_t kNumberOfPoolBuckets =
+      kMaxPooledSegmentSizeLog2 - kMinPooledSegmentSizeLog2 + 1;
+
+  AccountingAllocator();
+  virtual ~AccountingAllocator();
 
   // Returns nullptr on failed allocation.
   virtual void* Allocate(size_t bytes);
   virtual void Free(void* memory, size_t bytes);
 
+  // Gets a segment of {bytes} size, preferably from the segment pool. Returns
+  // nullptr on failed allocation.
+  void* GetSegment(size_t bytes);
+
+  // Puts a segment of {bytes} size back into the segment pool, or frees it if
+  // the pool holds enough segments of that size already.
+  void ReturnSegment(void* memory, size_t bytes);
+
+  // Sets the maximum number of bytes that the segment pool may hold. The pool
+  // is split evenly between the pooled segment sizes. A size of 0 disables
+  // the segment pool.
+  void ConfigureSegmentPool(size_t max_pool_size);
+
+  // Frees half of the pooled segments of every size.
+  void DecaySegmentPool();
+
+  // Frees all pooled segments. The destructor does this through the Free()
+  // of this class, so subclasses that override Free() with something other
+  // than free() have to clear the pool in their own destructor.
+  void ClearSegmentPool();
+
   size_t GetCurrentMemoryUsage() const;
   size_t GetMaxMemoryUsage() const;
+  size_t GetCurrentPoolSize() const;
+
+ protected:
+  // Called when GetSegment() hands out a pooled segment or ReturnSegment()
+  // keeps a segment in the pool. Both change the current memory usage
+  // without going through Allocate() or Free().
+  virtual void OnSegmentReused(size_t bytes) {}
+  virtual void OnSegmentPooled(size_t bytes) {}
 
  private:
+  // Pooled segments are chained through their first word.
+  struct PooledSegment {
+    PooledSegment* next;
+  };
+
+  static bool IsPooledSegmentSize(size_t bytes);
+  static size_t PoolBucketFor(size_t bytes);
+
+  void IncreaseMemoryUsage(size_t bytes);
+  void DecreaseMemoryUsage(size_t bytes);
+
+  // Unlinks all but {keep} pooled segments of the given {bucket} and returns
+  // them, still chained. Must be called with {pool_mutex_} held.
+  PooledSegment* TrimPoolBucket(size_t bucket, size_t keep);
+
+  // Releases a chain of segments unlinked by TrimPoolBucket() through Free().
+  // Must be called without {pool_mutex_} held.
+  void FreePooledSegments(PooledSegment* segments, size_t bucket);
+
   AtomicWord current_memory_usage_ = 0;
   AtomicWord max_memory_usage_ = 0;
+  AtomicWord current_pool_size_ = 0;
+
+  Mutex pool_mutex_;
+  PooledSegment* pool_heads_[kNumberOfPoolBuckets];
+  size_t pool_counts_[kNumberOfPoolBuckets];
+  size_t pool_max_counts_[kNumberOfPoolBuckets];
 
   DISALLOW_COPY_AND_ASSIGN(AccountingAllocator);
 };
@@ -3466,8 +3466,7 @@ bool Genesis::InstallSpecialObjects(Handle<Context> native_context) {
       native_context->global_object()));
 
   Handle<JSObject> Error = isolate->error_function();
-  Handle<String> name =
-      factory->InternalizeOneByteString(STATIC_CHAR_VECTOR("stackTraceLimit"));
+  Handle<String> name = factory->stackTraceLimit_string();
   Handle<Smi> stack_trace_limit(Smi::FromInt(FLAG_stack_trace_limit), isolate);
   JSObject::AddProperty(Error, name, stack_trace_limit, NONE);
 
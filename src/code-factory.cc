@@ -457,9 +457,9 @@ Callable CodeFactory::FastCloneRegExp(Isolate* isolate) {
 }
 
 // static
-Callable CodeFactory::FastCloneShallowArray(Isolate* isolate) {
-  // TODO(mstarzinger): Thread through AllocationSiteMode at some point.
-  FastCloneShallowArrayStub stub(isolate, DONT_TRACK_ALLOCATION_SITE);
+Callable CodeFactory::FastCloneShallowArray(Isolate* isolate,
+                                            AllocationSiteMode mode) {
+  FastCloneShallowArrayStub stub(isolate, mode);
   return make_callable(stub);
 }
 
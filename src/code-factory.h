@@ -123,7 +123,8 @@ class CodeFactory final {
   static Callable Typeof(Isolate* isolate);
 
   static Callable FastCloneRegExp(Isolate* isolate);
-  static Callable FastCloneShallowArray(Isolate* isolate);
+  static Callable FastCloneShallowArray(Isolate* isolate,
+                                        AllocationSiteMode mode);
   static Callable FastCloneShallowObject(Isolate* isolate, int length);
 
   static Callable FastNewContext(Isolate* isolate, int slot_count);
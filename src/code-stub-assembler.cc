@@ -6,6 +6,7 @@
 #include "src/code-factory.h"
 #include "src/frames-inl.h"
 #include "src/frames.h"
+#include "src/ic/handler-configuration.h"
 #include "src/ic/stub-cache.h"
 
 namespace v8 {
@@ -2983,25 +2984,31 @@ void CodeStubAssembler::HandleLoadICHandlerCase(const LoadICParameters* p,
   Label call_handler(this);
   GotoUnless(WordIsSmi(handler), &call_handler);
 
-  // |handler| is a Smi. It encodes a field index as obtained by
-  // FieldIndex.GetLoadByFieldOffset().
+  // |handler| is a Smi. It encodes either a field load or a constant load as
+  // described by LoadHandler.
   // TODO(jkummerow): For KeyedLoadICs, extend this scheme to encode
   // fast *element* loads.
   {
     Variable var_double_value(this, MachineRepresentation::kFloat64);
-    Label rebox_double(this, &var_double_value);
+    Label rebox_double(this, &var_double_value), constant(this);
 
     Node* handler_word = SmiUntag(handler);
+    Node* kind_bits =
+        WordAnd(handler_word, IntPtrConstant(LoadHandler::KindBits::kMask));
+    GotoIf(WordEqual(kind_bits, IntPtrConstant(LoadHandler::KindBits::encode(
+                                    LoadHandler::kForConstants))),
+           &constant);
+
     // |handler_word| is a field index as obtained by
     // FieldIndex.GetLoadByFieldOffset():
     Label inobject_double(this), out_of_object(this),
         out_of_object_double(this);
     Node* inobject_bit = WordAnd(
-        handler_word, IntPtrConstant(FieldIndex::FieldOffsetIsInobject::kMask));
+        handler_word, IntPtrConstant(LoadHandler::IsInobjectBits::kMask));
     Node* double_bit = WordAnd(
-        handler_word, IntPtrConstant(FieldIndex::FieldOffsetIsDouble::kMask));
+        handler_word, IntPtrConstant(LoadHandler::IsDoubleBits::kMask));
     Node* offset = WordSar(
-        handler_word, IntPtrConstant(FieldIndex::FieldOffsetOffset::kShift));
+        handler_word, IntPtrConstant(LoadHandler::FieldOffsetBits::kShift));
 
     GotoIf(WordEqual(inobject_bit, IntPtrConstant(0)), &out_of_object);
 
@@ -3030,6 +3037,19 @@ void CodeStubAssembler::HandleLoadICHandlerCase(const LoadICParameters* p,
 
     Bind(&rebox_double);
     Return(AllocateHeapNumberWithValue(var_double_value.value()));
+
+    // |handler_word| is the descriptor of a constant in the receiver map.
+    Bind(&constant);
+    Node* descriptor = WordShr(
+        handler_word, IntPtrConstant(LoadHandler::DescriptorBits::kShift));
+    Node* value_offset = IntPtrAdd(
+        IntPtrMul(descriptor, IntPtrConstant(DescriptorArray::kDescriptorSize *
+                                             kPointerSize)),
+        IntPtrConstant(FixedArray::OffsetOfElementAt(
+                           DescriptorArray::ToValueIndex(0)) -
+                       kHeapObjectTag));
+    Node* descriptors = LoadMapDescriptors(LoadMap(p->receiver));
+    Return(Load(MachineType::AnyTagged(), descriptors, value_offset));
   }
 
   // |handler| is a heap object. Must be code, call it.
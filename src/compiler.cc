@@ -348,6 +348,11 @@ void CompilationJob::RecordOptimizationStats() {
     int opt_count = function->shared()->opt_count();
     function->shared()->set_opt_count(opt_count + 1);
   }
+  isolate()->counters()->runtime_event_counters()->RecordCompile(
+      info()->code()->is_turbofanned() ? RuntimeEventCounters::kTurboFan
+                                       : RuntimeEventCounters::kCrankshaft,
+      time_taken_to_create_graph_ + time_taken_to_optimize_ +
+          time_taken_to_codegen_);
   double ms_creategraph = time_taken_to_create_graph_.InMillisecondsF();
   double ms_optimize = time_taken_to_optimize_.InMillisecondsF();
   double ms_codegen = time_taken_to_codegen_.InMillisecondsF();
@@ -416,6 +421,16 @@ void RecordFunctionCompilation(CodeEventListener::LogEventsAndTags tag,
     PROFILE(info->isolate(),
             CodeCreateEvent(log_tag, *abstract_code, *shared, script_name,
                             line_num, column_num));
+    // Interpreted functions may run on their own trampoline copy, which
+    // native profilers only see if it is logged under the function's name.
+    if (info->has_bytecode_array() &&
+        info->code()->is_interpreter_trampoline_builtin() &&
+        !info->code().is_identical_to(
+            info->isolate()->builtins()->InterpreterEntryTrampoline())) {
+      PROFILE(info->isolate(),
+              CodeCreateEvent(log_tag, AbstractCode::cast(*info->code()),
+                              *shared, script_name, line_num, column_num));
+    }
   }
 }
 
@@ -486,14 +501,20 @@ bool GenerateUnoptimizedCode(CompilationInfo* info) {
       return true;
     }
   }
+  base::ElapsedTimer timer;
+  timer.Start();
+  RuntimeEventCounters::CompilerTier tier;
   if (ShouldUseIgnition(info)) {
+    tier = RuntimeEventCounters::kIgnition;
     success = interpreter::Interpreter::MakeBytecode(info);
   } else {
+    tier = RuntimeEventCounters::kFullCodegen;
     success = FullCodeGenerator::MakeCode(info);
   }
   if (success) {
     Isolate* isolate = info->isolate();
     Counters* counters = isolate->counters();
+    counters->runtime_event_counters()->RecordCompile(tier, timer.Elapsed());
     // TODO(4280): Rename counters from "baseline" to "unoptimized" eventually.
     counters->total_baseline_code_size()->Increment(CodeAndMetadataSize(info));
     counters->total_baseline_compile_count()->Increment(1);
@@ -662,7 +683,7 @@ bool GetOptimizedCodeNow(CompilationJob* job) {
     EnsureFeedbackMetadata(info);
   }
 
-  JSFunction::EnsureLiterals(info->closure());
+  JSFunction::EnsureFeedbackVector(info->closure());
 
   TimerEventScope<TimerEventRecompileSynchronous> timer(isolate);
   RuntimeCallTimerScope runtimeTimer(isolate,
@@ -721,7 +742,7 @@ bool GetOptimizedCodeLater(CompilationJob* job) {
     EnsureFeedbackMetadata(info);
   }
 
-  JSFunction::EnsureLiterals(info->closure());
+  JSFunction::EnsureFeedbackVector(info->closure());
 
   // Reopen handles in the new CompilationHandleScope.
   info->ReopenHandlesInNewHandleScope();
@@ -980,7 +1001,9 @@ MaybeHandle<Code> GetBaselineCode(Handle<JSFunction> function) {
 
   // TODO(4280): For now we play it safe and remove the bytecode array when we
   // switch to baseline code. We might consider keeping around the bytecode so
-  // that it can be used as the "source of truth" eventually.
+  // that it can be used as the "source of truth" eventually. Baseline code
+  // needs the feedback vectors the interpreter may not have allocated yet.
+  SharedFunctionInfo::AllocatePendingFeedbackVectors(shared);
   shared->ClearBytecodeArray();
 
   // Update the shared function info with the scope info.
@@ -1229,7 +1252,7 @@ bool Compiler::CompileBaseline(Handle<JSFunction> function) {
 
   // Install code on closure.
   function->ReplaceCode(*code);
-  JSFunction::EnsureLiterals(function);
+  JSFunction::EnsureFeedbackVector(function);
 
   // Check postconditions on success.
   DCHECK(!isolate->has_pending_exception());
@@ -1263,7 +1286,7 @@ bool Compiler::CompileOptimized(Handle<JSFunction> function,
 
   // Install code on closure.
   function->ReplaceCode(*code);
-  JSFunction::EnsureLiterals(function);
+  JSFunction::EnsureFeedbackVector(function);
 
   // Check postconditions on success.
   DCHECK(!isolate->has_pending_exception());
@@ -1410,7 +1433,9 @@ bool Compiler::EnsureDeoptimizationSupport(CompilationInfo* info) {
 
     // TODO(4280): For now we play it safe and remove the bytecode array when we
     // switch to baseline code. We might consider keeping around the bytecode so
-    // that it can be used as the "source of truth" eventually.
+    // that it can be used as the "source of truth" eventually. Baseline code
+    // needs the feedback vectors the interpreter may not have allocated yet.
+    SharedFunctionInfo::AllocatePendingFeedbackVectors(shared);
     shared->ClearBytecodeArray();
 
     // The scope info might not have been set if a lazily compiled
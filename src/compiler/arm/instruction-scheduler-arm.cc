@@ -139,8 +139,176 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // TODO(all): Add instruction cost modeling.
-  return 1;
+  // Basic latency modeling for arm instructions. The numbers follow the
+  // in-order Cortex-A7/A53 class of cores, which are the most common ones in
+  // low end devices and also suffer the most from unscheduled code.
+  switch (instr->arch_opcode()) {
+    case kArmAdd:
+    case kArmAnd:
+    case kArmBic:
+    case kArmCmp:
+    case kArmCmn:
+    case kArmTst:
+    case kArmTeq:
+    case kArmOrr:
+    case kArmEor:
+    case kArmSub:
+    case kArmRsb:
+    case kArmMov:
+    case kArmMvn:
+      // The barrel shifter costs an extra cycle for shifted operands.
+      switch (instr->addressing_mode()) {
+        case kMode_Operand2_R_ASR_I:
+        case kMode_Operand2_R_LSL_I:
+        case kMode_Operand2_R_LSR_I:
+        case kMode_Operand2_R_ROR_I:
+        case kMode_Operand2_R_ASR_R:
+        case kMode_Operand2_R_LSL_R:
+        case kMode_Operand2_R_LSR_R:
+        case kMode_Operand2_R_ROR_R:
+          return 2;
+        default:
+          return 1;
+      }
+
+    case kArmClz:
+    case kArmBfc:
+    case kArmUbfx:
+    case kArmSbfx:
+    case kArmSxtb:
+    case kArmSxth:
+    case kArmUxtb:
+    case kArmUxth:
+    case kArmRbit:
+      return 1;
+
+    case kArmSxtab:
+    case kArmSxtah:
+    case kArmUxtab:
+    case kArmUxtah:
+    case kArmAddPair:
+    case kArmSubPair:
+      return 2;
+
+    case kArmLslPair:
+    case kArmLsrPair:
+    case kArmAsrPair:
+      return 3;
+
+    case kArmMul:
+    case kArmMla:
+    case kArmMls:
+      return 3;
+
+    case kArmSmmul:
+    case kArmSmmla:
+    case kArmSmull:
+    case kArmUmull:
+      return 4;
+
+    case kArmMulPair:
+      return 6;
+
+    case kArmSdiv:
+    case kArmUdiv:
+      return 12;
+
+    case kArmLdrb:
+    case kArmLdrsb:
+    case kArmLdrh:
+    case kArmLdrsh:
+    case kArmLdr:
+      return 3;
+
+    case kArmVldrF32:
+    case kArmVldrF64:
+      return 4;
+
+    case kArmVstrF32:
+    case kArmVstrF64:
+    case kArmStrb:
+    case kArmStrh:
+    case kArmStr:
+    case kArmPush:
+    case kArmPoke:
+      return 1;
+
+    case kArmVabsF32:
+    case kArmVnegF32:
+    case kArmVabsF64:
+    case kArmVnegF64:
+    case kArmVmovU32F32:
+    case kArmVmovF32U32:
+    case kArmVmovLowU32F64:
+    case kArmVmovLowF64U32:
+    case kArmVmovHighU32F64:
+    case kArmVmovHighF64U32:
+    case kArmVmovF64U32U32:
+    case kArmVmovU32U32F64:
+      return 3;
+
+    case kArmVcmpF32:
+    case kArmVcmpF64:
+    case kArmVaddF32:
+    case kArmVsubF32:
+    case kArmVaddF64:
+    case kArmVsubF64:
+    case kArmVmulF32:
+    case kArmFloat64Max:
+    case kArmFloat64Min:
+    case kArmFloat64SilenceNaN:
+      return 4;
+
+    case kArmVmulF64:
+    case kArmVrintmF32:
+    case kArmVrintmF64:
+    case kArmVrintpF32:
+    case kArmVrintpF64:
+    case kArmVrintzF32:
+    case kArmVrintzF64:
+    case kArmVrintaF64:
+    case kArmVrintnF32:
+    case kArmVrintnF64:
+    case kArmVcvtF32F64:
+    case kArmVcvtF64F32:
+    case kArmVcvtF32S32:
+    case kArmVcvtF32U32:
+    case kArmVcvtF64S32:
+    case kArmVcvtF64U32:
+    case kArmVcvtS32F32:
+    case kArmVcvtU32F32:
+    case kArmVcvtS32F64:
+    case kArmVcvtU32F64:
+      return 5;
+
+    case kArmVmlaF32:
+    case kArmVmlsF32:
+    case kArmVmlaF64:
+    case kArmVmlsF64:
+      return 8;
+
+    case kArmVdivF32:
+    case kArmVsqrtF32:
+      return 15;
+
+    case kArmVdivF64:
+    case kArmVsqrtF64:
+      return 29;
+
+    case kCheckedLoadInt8:
+    case kCheckedLoadUint8:
+    case kCheckedLoadInt16:
+    case kCheckedLoadUint16:
+    case kCheckedLoadWord32:
+      return 4;
+
+    case kCheckedLoadFloat32:
+    case kCheckedLoadFloat64:
+      return 5;
+
+    default:
+      return 1;
+  }
 }
 
 }  // namespace compiler
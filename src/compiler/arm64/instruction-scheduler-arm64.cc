@@ -207,8 +207,12 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
         return 1;
       }
 
+    case kArm64Bfi:
     case kArm64Clz:
     case kArm64Clz32:
+    case kArm64Mov32:
+    case kArm64Rbit:
+    case kArm64Rbit32:
     case kArm64Sbfx32:
     case kArm64Sxtb32:
     case kArm64Sxth32:
@@ -268,6 +272,8 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Mneg32:
     case kArm64Msub32:
     case kArm64Mul32:
+    case kArm64Smull:
+    case kArm64Umull:
       return 3;
 
     case kArm64Madd:
@@ -280,14 +286,26 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Udiv32:
       return 12;
 
+    case kArm64Imod32:
+    case kArm64Umod32:
+      // A division followed by a multiply-subtract.
+      return 15;
+
     case kArm64Idiv:
     case kArm64Udiv:
       return 20;
 
+    case kArm64Imod:
+    case kArm64Umod:
+      return 25;
+
     case kArm64Float32Add:
     case kArm64Float32Sub:
+    case kArm64Float32Mul:
     case kArm64Float64Add:
     case kArm64Float64Sub:
+    case kArm64Float64Mul:
+    case kArm64Float64SilenceNaN:
       return 5;
 
     case kArm64Float32Abs:
@@ -296,6 +314,14 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kArm64Float64Abs:
     case kArm64Float64Cmp:
     case kArm64Float64Neg:
+    case kArm64Float64Max:
+    case kArm64Float64Min:
+    case kArm64Float64ExtractLowWord32:
+    case kArm64Float64ExtractHighWord32:
+    case kArm64Float64InsertLowWord32:
+    case kArm64Float64InsertHighWord32:
+    case kArm64Float64MoveU64:
+    case kArm64U64MoveFloat64:
       return 3;
 
     case kArm64Float32Div:
@@ -319,15 +345,19 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
 
     case kArm64Float32ToFloat64:
     case kArm64Float64ToFloat32:
+    case kArm64Float32ToInt32:
+    case kArm64Float32ToUint32:
     case kArm64Float64ToInt32:
     case kArm64Float64ToUint32:
     case kArm64Float32ToInt64:
     case kArm64Float64ToInt64:
     case kArm64Float32ToUint64:
     case kArm64Float64ToUint64:
+    case kArm64Int32ToFloat32:
     case kArm64Int32ToFloat64:
     case kArm64Int64ToFloat32:
     case kArm64Int64ToFloat64:
+    case kArm64Uint32ToFloat32:
     case kArm64Uint32ToFloat64:
     case kArm64Uint64ToFloat32:
     case kArm64Uint64ToFloat64:
@@ -0,0 +1,188 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+
+#include <cmath>
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/type-cache.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+BoundsCheckElimination::BoundsCheckElimination(Editor* editor,
+                                               JSGraph* jsgraph)
+    : AdvancedReducer(editor),
+      jsgraph_(jsgraph),
+      type_cache_(TypeCache::Get()) {}
+
+BoundsCheckElimination::~BoundsCheckElimination() {}
+
+Reduction BoundsCheckElimination::Reduce(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
+    case IrOpcode::kLoadBuffer:
+      return ReduceLoadBuffer(node);
+    case IrOpcode::kStoreBuffer:
+      return ReduceStoreBuffer(node);
+    default:
+      break;
+  }
+  return NoChange();
+}
+
+Reduction BoundsCheckElimination::ReduceCheckBounds(Node* node) {
+  Node* const index = NodeProperties::GetValueInput(node, 0);
+  Node* const length = NodeProperties::GetValueInput(node, 1);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  Type* const length_type = NodeProperties::GetType(length);
+  if (!length_type->IsInhabited() || !length_type->Is(Type::Number())) {
+    return NoChange();
+  }
+  if (IsInBounds(index, length, length_type->Min(), control)) {
+    ReplaceWithValue(node, index, effect);
+    return Replace(index);
+  }
+  return NoChange();
+}
+
+Reduction BoundsCheckElimination::ReduceLoadBuffer(Node* node) {
+  BufferAccess const access = BufferAccessOf(node->op());
+  int const k = ElementSizeLog2Of(access.machine_type().representation());
+  Node* const index =
+      GetBufferIndex(NodeProperties::GetValueInput(node, 1), k);
+  NumberMatcher mlength(NodeProperties::GetValueInput(node, 2));
+  Node* const control = NodeProperties::GetControlInput(node);
+  if (index == nullptr || !mlength.HasValue()) return NoChange();
+  double const limit = std::floor(mlength.Value() / (1 << k));
+  if (IsInBounds(index, nullptr, limit, control)) {
+    // LoadBuffer(buffer, offset, length) => LoadElement(buffer, index)
+    node->ReplaceInput(1, index);
+    node->RemoveInput(2);
+    NodeProperties::ChangeOp(
+        node, simplified()->LoadElement(AccessBuilder::ForTypedArrayElement(
+                  access.external_array_type(), true)));
+    // The load can no longer produce undefined.
+    NodeProperties::SetType(
+        node, Type::Intersect(NodeProperties::GetType(node), Type::Number(),
+                              jsgraph()->zone()));
+    return Changed(node);
+  }
+  return NoChange();
+}
+
+Reduction BoundsCheckElimination::ReduceStoreBuffer(Node* node) {
+  BufferAccess const access = BufferAccessOf(node->op());
+  int const k = ElementSizeLog2Of(access.machine_type().representation());
+  Node* const index =
+      GetBufferIndex(NodeProperties::GetValueInput(node, 1), k);
+  NumberMatcher mlength(NodeProperties::GetValueInput(node, 2));
+  Node* const control = NodeProperties::GetControlInput(node);
+  if (index == nullptr || !mlength.HasValue()) return NoChange();
+  double const limit = std::floor(mlength.Value() / (1 << k));
+  if (IsInBounds(index, nullptr, limit, control)) {
+    // StoreBuffer(buffer, offset, length, value)
+    //   => StoreElement(buffer, index, value)
+    node->ReplaceInput(1, index);
+    node->RemoveInput(2);
+    NodeProperties::ChangeOp(
+        node, simplified()->StoreElement(AccessBuilder::ForTypedArrayElement(
+                  access.external_array_type(), true)));
+    return Changed(node);
+  }
+  return NoChange();
+}
+
+bool BoundsCheckElimination::IsInBounds(Node* index, Node* length,
+                                        double limit, Node* control) const {
+  // The {index} must be a non-negative integer; this also covers the
+  // ranges computed for induction variables.
+  Type* const index_type = NodeProperties::GetType(index);
+  if (!index_type->IsInhabited() || !index_type->Is(type_cache_.kInteger) ||
+      index_type->Min() < 0) {
+    return false;
+  }
+  if (index_type->Max() < limit) return true;
+
+  // Otherwise look for a comparison on the control path to {control} that
+  // proves that the {index} is below the {length} or the {limit}.
+  for (int i = 0; i < kMaxControlWalk; ++i) {
+    switch (control->opcode()) {
+      case IrOpcode::kIfTrue: {
+        // Branch(index < bound) is true.
+        Node* const condition = control->InputAt(0)->InputAt(0);
+        if ((condition->opcode() == IrOpcode::kNumberLessThan ||
+             condition->opcode() == IrOpcode::kSpeculativeNumberLessThan) &&
+            condition->InputAt(0) == index &&
+            IsBelowLimit(condition->InputAt(1), length, limit)) {
+          return true;
+        }
+        break;
+      }
+      case IrOpcode::kIfFalse: {
+        // Branch(bound <= index) is false, which only implies that the
+        // {index} is below the bound if the bound is not NaN.
+        Node* const condition = control->InputAt(0)->InputAt(0);
+        if ((condition->opcode() == IrOpcode::kNumberLessThanOrEqual ||
+             condition->opcode() ==
+                 IrOpcode::kSpeculativeNumberLessThanOrEqual) &&
+            condition->InputAt(1) == index &&
+            NodeProperties::GetType(condition->InputAt(0))
+                ->Is(type_cache_.kInteger) &&
+            IsBelowLimit(condition->InputAt(0), length, limit)) {
+          return true;
+        }
+        break;
+      }
+      case IrOpcode::kLoop:
+      case IrOpcode::kMerge:
+      case IrOpcode::kStart:
+        return false;
+      default:
+        break;
+    }
+    // Continue with the immediate dominator on the control chain.
+    if (control->op()->ControlInputCount() != 1) return false;
+    control = NodeProperties::GetControlInput(control);
+    if (control->opcode() == IrOpcode::kBranch) {
+      control = NodeProperties::GetControlInput(control);
+    }
+  }
+  return false;
+}
+
+bool BoundsCheckElimination::IsBelowLimit(Node* bound, Node* length,
+                                          double limit) const {
+  if (bound == length) return true;
+  Type* const bound_type = NodeProperties::GetType(bound);
+  return bound_type->IsInhabited() && bound_type->Is(Type::Number()) &&
+         bound_type->Max() <= limit;
+}
+
+Node* BoundsCheckElimination::GetBufferIndex(Node* offset,
+                                             int element_size_log2) const {
+  if (element_size_log2 == 0) return offset;
+  // JSTypedLowering computes the byte offset as NumberShiftLeft(index, k).
+  if (offset->opcode() == IrOpcode::kNumberShiftLeft) {
+    NumberMatcher mshift(offset->InputAt(1));
+    if (mshift.Is(element_size_log2)) return offset->InputAt(0);
+  }
+  return nullptr;
+}
+
+SimplifiedOperatorBuilder* BoundsCheckElimination::simplified() const {
+  return jsgraph()->simplified();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
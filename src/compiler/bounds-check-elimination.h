@@ -0,0 +1,59 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+#define V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
+
+#include "src/compiler/graph-reducer.h"
+
+namespace v8 {
+namespace internal {
+
+// Forward declarations.
+class TypeCache;
+
+namespace compiler {
+
+// Forward declarations.
+class CommonOperatorBuilder;
+class JSGraph;
+class SimplifiedOperatorBuilder;
+
+// Removes the bounds checks of element accesses whose index is known to be
+// in range, either from its type (which includes the ranges that the typer
+// computes for induction variables) or from a dominating comparison of the
+// index against the length, as found in typical counting loops.
+class BoundsCheckElimination final : public AdvancedReducer {
+ public:
+  BoundsCheckElimination(Editor* editor, JSGraph* jsgraph);
+  ~BoundsCheckElimination() final;
+
+  Reduction Reduce(Node* node) final;
+
+ private:
+  // Upper bound on the number of control nodes we look at to find a
+  // dominating comparison.
+  static const int kMaxControlWalk = 64;
+
+  Reduction ReduceCheckBounds(Node* node);
+  Reduction ReduceLoadBuffer(Node* node);
+  Reduction ReduceStoreBuffer(Node* node);
+
+  bool IsInBounds(Node* index, Node* length, double limit,
+                  Node* control) const;
+  bool IsBelowLimit(Node* bound, Node* length, double limit) const;
+  Node* GetBufferIndex(Node* offset, int element_size_log2) const;
+
+  JSGraph* jsgraph() const { return jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() const;
+
+  JSGraph* const jsgraph_;
+  TypeCache const& type_cache_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_BOUNDS_CHECK_ELIMINATION_H_
@@ -1456,6 +1456,12 @@ void BytecodeGraphBuilder::VisitDebugger() {
 DEBUG_BREAK_BYTECODE_LIST(DEBUG_BREAK);
 #undef DEBUG_BREAK
 
+// Short-form bytecodes are presented in their long form by the iterator.
+#define SHORT_FORM(Name, ...) \
+  void BytecodeGraphBuilder::Visit##Name() { UNREACHABLE(); }
+SHORT_FORM_BYTECODE_LIST(SHORT_FORM);
+#undef SHORT_FORM
+
 void BytecodeGraphBuilder::BuildForInPrepare() {
   FrameStateBeforeAndAfter states(this);
   Node* receiver = environment()->LookupAccumulator();
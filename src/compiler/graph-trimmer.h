@@ -35,6 +35,10 @@ class GraphTrimmer final {
     TrimGraph();
   }
 
+  // The nodes that survived the last call to TrimGraph, in the order in which
+  // they were discovered.
+  NodeVector const& live() const { return live_; }
+
  private:
   V8_INLINE bool IsLive(Node* const node) { return is_live_.Get(node); }
   V8_INLINE void MarkAsLive(Node* const node) {
@@ -66,6 +66,13 @@ Node* Graph::CloneNode(const Node* node) {
 }
 
 
+void Graph::RenumberNodes(ZoneVector<Node*> const& nodes) {
+  NodeId id = 0;
+  for (Node* const node : nodes) node->set_id(id++);
+  next_node_id_ = id;
+}
+
+
 NodeId Graph::NextNodeId() {
   NodeId const id = next_node_id_;
   CHECK(!base::bits::UnsignedAddOverflow32(id, 1, &next_node_id_));
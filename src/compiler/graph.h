@@ -115,6 +115,11 @@ class Graph final : public ZoneObject {
 
   size_t NodeCount() const { return next_node_id_; }
 
+  // Assigns the ids [0, nodes.size()[ to the {nodes} in order, so that side
+  // tables indexed by node id no longer cover nodes that were trimmed. The
+  // {nodes} must include every node that is still reachable in any way.
+  void RenumberNodes(ZoneVector<Node*> const& nodes);
+
   void Decorate(Node* node);
   void AddDecorator(GraphDecorator* decorator);
   void RemoveDecorator(GraphDecorator* decorator);
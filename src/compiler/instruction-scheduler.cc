@@ -6,6 +6,7 @@
 
 #include "src/base/adapters.h"
 #include "src/base/utils/random-number-generator.h"
+#include "src/register-configuration.h"
 
 namespace v8 {
 namespace internal {
@@ -15,6 +16,17 @@ namespace compiler {
 // node2 (i.e. node1 should be scheduled before node2).
 bool InstructionScheduler::CriticalPathFirstQueue::CompareNodes(
     ScheduleGraphNode *node1, ScheduleGraphNode *node2) const {
+  int delta1 = 0;
+  int delta2 = 0;
+  if (scheduler_->IsRegisterPressureHigh(false)) {
+    delta1 += node1->RegisterPressureDelta(false);
+    delta2 += node2->RegisterPressureDelta(false);
+  }
+  if (scheduler_->IsRegisterPressureHigh(true)) {
+    delta1 += node1->RegisterPressureDelta(true);
+    delta2 += node2->RegisterPressureDelta(true);
+  }
+  if (delta1 != delta2) return delta1 < delta2;
   return node1->total_latency() > node2->total_latency();
 }
 
@@ -58,10 +70,14 @@ InstructionScheduler::StressSchedulerQueue::PopBestCandidate(int cycle) {
 
 InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(
     Zone* zone,
-    Instruction* instr)
+    Instruction* instr,
+    bool defines_fp_value)
     : instr_(instr),
       successors_(zone),
+      operands_(zone),
+      defines_fp_value_(defines_fp_value),
       unscheduled_predecessors_count_(0),
+      unscheduled_uses_count_(0),
       latency_(GetInstructionLatency(instr)),
       total_latency_(-1),
       start_cycle_(-1) {
@@ -75,6 +91,26 @@ void InstructionScheduler::ScheduleGraphNode::AddSuccessor(
 }
 
 
+void InstructionScheduler::ScheduleGraphNode::AddUse(ScheduleGraphNode* node) {
+  node->operands_.push_back(this);
+  unscheduled_uses_count_++;
+}
+
+
+int InstructionScheduler::ScheduleGraphNode::RegisterPressureDelta(
+    bool fp) const {
+  int delta = (HasUnscheduledUses() && defines_fp_value_ == fp) ? 1 : 0;
+  for (ScheduleGraphNode* operand : operands_) {
+    // This is the last use of the operand.
+    if (operand->defines_fp_value_ == fp &&
+        operand->unscheduled_uses_count_ == 1) {
+      delta--;
+    }
+  }
+  return delta;
+}
+
+
 InstructionScheduler::InstructionScheduler(Zone* zone,
                                            InstructionSequence* sequence)
     : zone_(zone),
@@ -83,7 +119,14 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
       last_side_effect_instr_(nullptr),
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
-      last_deopt_(nullptr) {
+      last_deopt_(nullptr),
+      live_general_values_count_(0),
+      live_fp_values_count_(0),
+      general_register_pressure_limit_(
+          RegisterConfiguration::Turbofan()
+              ->num_allocatable_general_registers()),
+      fp_register_pressure_limit_(RegisterConfiguration::Turbofan()
+                                      ->num_allocatable_double_registers()) {
 }
 
 
@@ -93,6 +136,8 @@ void InstructionScheduler::StartBlock(RpoNumber rpo) {
   DCHECK(pending_loads_.empty());
   DCHECK(last_live_in_reg_marker_ == nullptr);
   DCHECK(last_deopt_ == nullptr);
+  DCHECK_EQ(0, live_general_values_count_);
+  DCHECK_EQ(0, live_fp_values_count_);
   sequence()->StartBlock(rpo);
 }
 
@@ -109,17 +154,23 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
   pending_loads_.clear();
   last_live_in_reg_marker_ = nullptr;
   last_deopt_ = nullptr;
+  live_general_values_count_ = 0;
+  live_fp_values_count_ = 0;
 }
 
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node =
+      new (zone()) ScheduleGraphNode(zone(), instr, DefinesFPValue(instr));
 
   if (IsBlockTerminator(instr)) {
     // Make sure that basic block terminators are not moved by adding them
     // as successor of every instruction.
     for (ScheduleGraphNode* node : graph_) {
       node->AddSuccessor(new_node);
+      if (HasOperandDependency(node->instruction(), instr)) {
+        node->AddUse(new_node);
+      }
     }
   } else if (IsFixedRegisterParameter(instr)) {
     if (last_live_in_reg_marker_ != nullptr) {
@@ -168,6 +219,7 @@ void InstructionScheduler::AddInstruction(Instruction* instr) {
     for (ScheduleGraphNode* node : graph_) {
       if (HasOperandDependency(node->instruction(), instr)) {
         node->AddSuccessor(new_node);
+        node->AddUse(new_node);
       }
     }
   }
@@ -197,6 +249,7 @@ void InstructionScheduler::ScheduleBlock() {
 
     if (candidate != nullptr) {
       sequence()->AddInstruction(candidate->instruction());
+      UpdateRegisterPressure(candidate);
 
       for (ScheduleGraphNode* successor : candidate->successors()) {
         successor->DropUnscheduledPredecessor();
@@ -365,6 +418,44 @@ void InstructionScheduler::ComputeTotalLatencies() {
   }
 }
 
+
+bool InstructionScheduler::DefinesFPValue(const Instruction* instr) const {
+  if (instr->OutputCount() == 0) return false;
+  const InstructionOperand* output = instr->OutputAt(0);
+  int virtual_register;
+  if (output->IsUnallocated()) {
+    virtual_register = UnallocatedOperand::cast(output)->virtual_register();
+  } else if (output->IsConstant()) {
+    virtual_register = ConstantOperand::cast(output)->virtual_register();
+  } else {
+    return false;
+  }
+  return sequence_->IsFP(virtual_register);
+}
+
+
+void InstructionScheduler::UpdateRegisterPressure(ScheduleGraphNode* node) {
+  // The value defined by 'node' is live until its last use is scheduled.
+  if (node->HasUnscheduledUses()) {
+    if (node->defines_fp_value()) {
+      live_fp_values_count_++;
+    } else {
+      live_general_values_count_++;
+    }
+  }
+  for (ScheduleGraphNode* operand : node->operands()) {
+    operand->DropUnscheduledUse();
+    if (operand->HasUnscheduledUses()) continue;
+    if (operand->defines_fp_value()) {
+      live_fp_values_count_--;
+    } else {
+      live_general_values_count_--;
+    }
+  }
+  DCHECK_LE(0, live_general_values_count_);
+  DCHECK_LE(0, live_fp_values_count_);
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
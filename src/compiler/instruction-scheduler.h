@@ -40,7 +40,7 @@ class InstructionScheduler final : public ZoneObject {
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode: public ZoneObject {
    public:
-    ScheduleGraphNode(Zone* zone, Instruction* instr);
+    ScheduleGraphNode(Zone* zone, Instruction* instr, bool defines_fp_value);
 
     // Mark the instruction represented by 'node' as a dependecy of this one.
     // The current instruction will be registered as an unscheduled predecessor
@@ -58,8 +58,30 @@ class InstructionScheduler final : public ZoneObject {
       unscheduled_predecessors_count_--;
     }
 
+    // Mark the instruction represented by 'node' as reading a value defined
+    // by this one. This is used to estimate the register pressure.
+    void AddUse(ScheduleGraphNode* node);
+
+    // Check if the value defined by this instruction is still needed by some
+    // unscheduled instruction.
+    bool HasUnscheduledUses() const { return unscheduled_uses_count_ != 0; }
+
+    // Record that we have scheduled one of the users of this node.
+    void DropUnscheduledUse() {
+      DCHECK(unscheduled_uses_count_ > 0);
+      unscheduled_uses_count_--;
+    }
+
+    // Check if the value defined by this instruction lives in an FP register.
+    bool defines_fp_value() const { return defines_fp_value_; }
+
+    // The number of values of the given register class that become live minus
+    // the number of those that die when this instruction is scheduled next.
+    int RegisterPressureDelta(bool fp) const;
+
     Instruction* instruction() { return instr_; }
     ZoneDeque<ScheduleGraphNode*>& successors() { return successors_; }
+    ZoneDeque<ScheduleGraphNode*>& operands() { return operands_; }
     int latency() const { return latency_; }
 
     int total_latency() const { return total_latency_; }
@@ -72,9 +94,18 @@ class InstructionScheduler final : public ZoneObject {
     Instruction* instr_;
     ZoneDeque<ScheduleGraphNode*> successors_;
 
+    // The nodes defining the values read by this instruction.
+    ZoneDeque<ScheduleGraphNode*> operands_;
+
     // Number of unscheduled predecessors for this node.
     int unscheduled_predecessors_count_;
 
+    // Whether the value defined by this node is held in an FP register.
+    bool defines_fp_value_;
+
+    // Number of unscheduled nodes reading the value defined by this node.
+    int unscheduled_uses_count_;
+
     // Estimate of the instruction latency (the number of cycles it takes for
     // instruction to complete).
     int latency_;
@@ -116,7 +147,10 @@ class InstructionScheduler final : public ZoneObject {
 
   // A scheduling queue which prioritize nodes on the critical path (we look
   // for the instruction with the highest latency on the path to reach the end
-  // of the graph).
+  // of the graph). Once the number of live values of a register class reaches
+  // the number of allocatable registers of that class, nodes which reduce the
+  // pressure on it are preferred, so that the scheduler doesn't introduce
+  // spills.
   class CriticalPathFirstQueue : public SchedulingQueueBase  {
    public:
     explicit CriticalPathFirstQueue(InstructionScheduler* scheduler)
@@ -187,6 +221,17 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
+  // Update the register pressure estimate after scheduling 'node'.
+  void UpdateRegisterPressure(ScheduleGraphNode* node);
+
+  bool IsRegisterPressureHigh(bool fp) const {
+    return fp ? live_fp_values_count_ >= fp_register_pressure_limit_
+              : live_general_values_count_ >= general_register_pressure_limit_;
+  }
+
+  // Check if the value defined by 'instr' is held in an FP register.
+  bool DefinesFPValue(const Instruction* instr) const;
+
   static int GetInstructionLatency(const Instruction* instr);
 
   Zone* zone() { return zone_; }
@@ -214,6 +259,18 @@ class InstructionScheduler final : public ZoneObject {
 
   // Last deoptimization instruction encountered while building the graph.
   ScheduleGraphNode* last_deopt_;
+
+  // Number of general and FP values defined in the current block which are
+  // still needed by unscheduled instructions, i.e. an estimate of the
+  // register pressure.
+  int live_general_values_count_;
+  int live_fp_values_count_;
+
+  // Number of live values of each register class at which the scheduler tries
+  // to reduce the pressure on that class instead of following the critical
+  // path.
+  int const general_register_pressure_limit_;
+  int const fp_register_pressure_limit_;
 };
 
 }  // namespace compiler
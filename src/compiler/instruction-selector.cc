@@ -1293,6 +1293,11 @@ void InstructionSelector::VisitNode(Node* node) {
     }
     case IrOpcode::kAtomicStore:
       return VisitAtomicStore(node);
+#define VISIT_SIMD_OP(Name) \
+  case IrOpcode::k##Name:   \
+    return MarkAsSimd128(node), Visit##Name(node);
+      MACHINE_SIMD_SUPPORTED_OP_LIST(VISIT_SIMD_OP)
+#undef VISIT_SIMD_OP
     default:
       V8_Fatal(__FILE__, __LINE__, "Unexpected operator #%d:%s @ node #%d",
                node->opcode(), node->op()->mnemonic(), node->id());
@@ -1651,6 +1656,14 @@ void InstructionSelector::VisitWord32PairShr(Node* node) { UNIMPLEMENTED(); }
 void InstructionSelector::VisitWord32PairSar(Node* node) { UNIMPLEMENTED(); }
 #endif  // V8_TARGET_ARCH_64_BIT
 
+// Only x64 implements the SIMD operators so far.
+#if !V8_TARGET_ARCH_X64
+#define UNIMPLEMENTED_SIMD_OP(Name) \
+  void InstructionSelector::Visit##Name(Node* node) { UNIMPLEMENTED(); }
+MACHINE_SIMD_SUPPORTED_OP_LIST(UNIMPLEMENTED_SIMD_OP)
+#undef UNIMPLEMENTED_SIMD_OP
+#endif  // !V8_TARGET_ARCH_X64
+
 void InstructionSelector::VisitFinishRegion(Node* node) { EmitIdentity(node); }
 
 void InstructionSelector::VisitParameter(Node* node) {
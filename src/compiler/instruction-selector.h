@@ -26,6 +26,25 @@ class Linkage;
 class OperandGenerator;
 struct SwitchInfo;
 
+// The SIMD machine operators that can be selected on targets that report
+// MachineOperatorBuilder::kSimd128Ops; they all produce a 128-bit value.
+#define MACHINE_SIMD_SUPPORTED_OP_LIST(V) \
+  V(CreateFloat32x4)                      \
+  V(Float32x4Add)                         \
+  V(Float32x4Sub)                         \
+  V(Float32x4Mul)                         \
+  V(Float32x4Div)                         \
+  V(CreateInt32x4)                        \
+  V(Int32x4Add)                           \
+  V(Int32x4Sub)                           \
+  V(Int32x4Mul)                           \
+  V(Int32x4ShiftLeftByScalar)             \
+  V(Int32x4ShiftRightByScalar)            \
+  V(Uint32x4ShiftRightByScalar)           \
+  V(Simd128And)                           \
+  V(Simd128Or)                            \
+  V(Simd128Xor)
+
 // This struct connects nodes of parameters which are going to be pushed on the
 // call stack with their parameter index in the call descriptor of the callee.
 class PushParameter {
@@ -228,6 +247,9 @@ class InstructionSelector final {
   void MarkAsFloat64(Node* node) {
     MarkAsRepresentation(MachineRepresentation::kFloat64, node);
   }
+  void MarkAsSimd128(Node* node) {
+    MarkAsRepresentation(MachineRepresentation::kSimd128, node);
+  }
   void MarkAsReference(Node* node) {
     MarkAsRepresentation(MachineRepresentation::kTagged, node);
   }
@@ -276,6 +298,7 @@ class InstructionSelector final {
 
 #define DECLARE_GENERATOR(x) void Visit##x(Node* node);
   MACHINE_OP_LIST(DECLARE_GENERATOR)
+  MACHINE_SIMD_SUPPORTED_OP_LIST(DECLARE_GENERATOR)
 #undef DECLARE_GENERATOR
 
   void VisitFinishRegion(Node* node);
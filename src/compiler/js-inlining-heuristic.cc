@@ -5,7 +5,10 @@
 #include "src/compiler/js-inlining-heuristic.h"
 
 #include "src/compiler.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/js-graph.h"
 #include "src/compiler/node-matchers.h"
+#include "src/compiler/simplified-operator.h"
 #include "src/objects-inl.h"
 
 namespace v8 {
@@ -19,51 +22,73 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   if (seen_.find(node->id()) != seen_.end()) return NoChange();
   seen_.insert(node->id());
 
+  // Check if the {node} is an eligible call site, and collect the call targets,
+  // which are either a single known constant or, for polymorphic call sites,
+  // the constant inputs of a {Phi} as produced by polymorphic property loads.
+  Candidate candidate;
+  candidate.node = node;
+  candidate.num_functions = 0;
   Node* callee = node->InputAt(0);
   HeapObjectMatcher match(callee);
-  if (!match.HasValue() || !match.Value()->IsJSFunction()) return NoChange();
-  Handle<JSFunction> function = Handle<JSFunction>::cast(match.Value());
-
-  // Functions marked with %SetForceInlineFlag are immediately inlined.
-  if (function->shared()->force_inline()) {
-    return inliner_.ReduceJSCall(node, function);
+  if (match.HasValue()) {
+    if (!match.Value()->IsJSFunction()) return NoChange();
+    candidate.functions[0] = Handle<JSFunction>::cast(match.Value());
+    candidate.num_functions = 1;
+  } else if (callee->opcode() == IrOpcode::kPhi &&
+             node->opcode() == IrOpcode::kJSCallFunction &&
+             FLAG_turbo_polymorphic_inlining) {
+    int const value_input_count = callee->op()->ValueInputCount();
+    for (int i = 0; i < value_input_count; ++i) {
+      HeapObjectMatcher m(callee->InputAt(i));
+      if (!m.HasValue() || !m.Value()->IsJSFunction()) return NoChange();
+      Handle<JSFunction> function = Handle<JSFunction>::cast(m.Value());
+      bool duplicate = false;
+      for (int j = 0; j < candidate.num_functions; ++j) {
+        if (candidate.functions[j].is_identical_to(function)) duplicate = true;
+      }
+      if (duplicate) continue;
+      if (candidate.num_functions == kMaxCallPolymorphism) return NoChange();
+      candidate.functions[candidate.num_functions++] = function;
+    }
+  } else {
+    return NoChange();
   }
 
-  // Handling of special inlining modes right away:
-  //  - For restricted inlining: stop all handling at this point.
-  //  - For stressing inlining: immediately handle all functions.
-  switch (mode_) {
-    case kRestrictedInlining:
-      return NoChange();
-    case kStressInlining:
+  // Polymorphic call sites are only handled by the general heuristic below.
+  if (callee->opcode() == IrOpcode::kPhi) {
+    if (mode_ != kGeneralInlining) return NoChange();
+  } else {
+    Handle<JSFunction> function = candidate.functions[0];
+
+    // Functions marked with %SetForceInlineFlag are immediately inlined.
+    if (function->shared()->force_inline()) {
       return inliner_.ReduceJSCall(node, function);
-    case kGeneralInlining:
-      break;
+    }
+
+    // Handling of special inlining modes right away:
+    //  - For restricted inlining: stop all handling at this point.
+    //  - For stressing inlining: immediately handle all functions.
+    switch (mode_) {
+      case kRestrictedInlining:
+        return NoChange();
+      case kStressInlining:
+        return inliner_.ReduceJSCall(node, function);
+      case kGeneralInlining:
+        break;
+    }
   }
 
   // ---------------------------------------------------------------------------
   // Everything below this line is part of the inlining heuristic.
   // ---------------------------------------------------------------------------
 
-  // Built-in functions are handled by the JSBuiltinReducer.
-  if (function->shared()->HasBuiltinFunctionId()) return NoChange();
-
-  // Don't inline builtins.
-  if (function->shared()->IsBuiltin()) return NoChange();
-
-  // Quick check on source code length to avoid parsing large candidate.
-  if (function->shared()->SourceSize() > FLAG_max_inlined_source_size) {
-    return NoChange();
-  }
-
-  // Quick check on the size of the AST to avoid parsing large candidate.
-  if (function->shared()->ast_node_count() > FLAG_max_inlined_nodes) {
-    return NoChange();
+  // All call targets must pass the size and kind limits.
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    if (!CanInlineFunction(candidate.functions[i])) return NoChange();
   }
 
   // Avoid inlining within or across the boundary of asm.js code.
   if (info_->shared_info()->asm_function()) return NoChange();
-  if (function->shared()->asm_function()) return NoChange();
 
   // Stop inlinining once the maximum allowed level is reached.
   int level = 0;
@@ -88,7 +113,7 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
       int const extra_index =
           p.feedback().vector()->GetIndex(p.feedback().slot()) + 1;
       Handle<Object> feedback_extra(p.feedback().vector()->get(extra_index),
-                                    function->GetIsolate());
+                                    jsgraph()->isolate());
       if (feedback_extra->IsSmi()) {
         calls = Handle<Smi>::cast(feedback_extra)->value();
       }
@@ -100,7 +125,8 @@ Reduction JSInliningHeuristic::Reduce(Node* node) {
   // ---------------------------------------------------------------------------
 
   // In the general case we remember the candidate for later.
-  candidates_.insert({function, node, calls});
+  candidate.calls = calls;
+  candidates_.insert(candidate);
   return NoChange();
 }
 
@@ -119,17 +145,114 @@ void JSInliningHeuristic::Finalize() {
     Candidate candidate = *i;
     candidates_.erase(i);
     // Make sure we don't try to inline dead candidate nodes.
-    if (!candidate.node->IsDead()) {
-      Reduction r = inliner_.ReduceJSCall(candidate.node, candidate.function);
-      if (r.Changed()) {
-        cumulative_count_ += candidate.function->shared()->ast_node_count();
-        return;
-      }
+    if (candidate.node->IsDead()) continue;
+    // Polymorphic call sites duplicate the call for every target, so make
+    // sure that all of them fit into the remaining budget.
+    if (candidate.num_functions > 1 &&
+        cumulative_count_ + CandidateSize(candidate) >
+            FLAG_max_inlined_nodes_cumulative) {
+      continue;
     }
+    Reduction r = InlineCandidate(candidate);
+    if (r.Changed()) return;
   }
 }
 
 
+bool JSInliningHeuristic::CanInlineFunction(
+    Handle<JSFunction> function) const {
+  // Built-in functions are handled by the JSBuiltinReducer.
+  if (function->shared()->HasBuiltinFunctionId()) return false;
+
+  // Don't inline builtins.
+  if (function->shared()->IsBuiltin()) return false;
+
+  // Quick check on source code length to avoid parsing large candidate.
+  if (function->shared()->SourceSize() > FLAG_max_inlined_source_size) {
+    return false;
+  }
+
+  // Quick check on the size of the AST to avoid parsing large candidate.
+  if (function->shared()->ast_node_count() > FLAG_max_inlined_nodes) {
+    return false;
+  }
+
+  // Avoid inlining across the boundary of asm.js code.
+  if (function->shared()->asm_function()) return false;
+  return true;
+}
+
+
+Reduction JSInliningHeuristic::InlineCandidate(Candidate const& candidate) {
+  Node* const node = candidate.node;
+  Node* const callee = node->InputAt(0);
+  if (callee->opcode() != IrOpcode::kPhi) {
+    if (candidate.num_functions > 1) return NoChange();
+    Reduction r = inliner_.ReduceJSCall(node, candidate.functions[0]);
+    if (r.Changed()) cumulative_count_ += CandidateSize(candidate);
+    return r;
+  }
+
+  // Polymorphic call sites inside try-blocks are not inlined, since the
+  // IfException projections of the cloned calls would have to be merged.
+  if (NodeProperties::IsExceptionalCall(node)) return NoChange();
+
+  // Dispatch on the identity of the {callee} and clone the call for every
+  // target; the last target needs no check, since the {Phi} cannot produce
+  // any other value.
+  int const num_calls = candidate.num_functions;
+  Node* calls[kMaxCallPolymorphism + 1];
+  Node* effect = NodeProperties::GetEffectInput(node);
+  Node* control = NodeProperties::GetControlInput(node);
+  for (int i = 0; i < num_calls; ++i) {
+    Node* target = jsgraph()->HeapConstant(candidate.functions[i]);
+    Node* if_target = control;
+    if (i != num_calls - 1) {
+      Node* check = graph()->NewNode(simplified()->ReferenceEqual(Type::Any()),
+                                     callee, target);
+      Node* branch = graph()->NewNode(common()->Branch(), check, control);
+      if_target = graph()->NewNode(common()->IfTrue(), branch);
+      control = graph()->NewNode(common()->IfFalse(), branch);
+    }
+    calls[i] = graph()->CloneNode(node);
+    calls[i]->ReplaceInput(0, target);
+    NodeProperties::ReplaceControlInput(calls[i], if_target);
+  }
+
+  // Join the results of the individual calls.
+  Node* merge = graph()->NewNode(common()->Merge(num_calls), num_calls, calls);
+  calls[num_calls] = merge;
+  Node* value = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kTagged, num_calls), num_calls + 1,
+      calls);
+  effect = graph()->NewNode(common()->EffectPhi(num_calls), num_calls + 1,
+                            calls);
+  ReplaceWithValue(node, value, effect, merge);
+  node->Kill();
+
+  // Inline the individual calls; targets that the inliner rejects are still
+  // called directly.
+  for (int i = 0; i < num_calls; ++i) {
+    Handle<JSFunction> function = candidate.functions[i];
+    Reduction r = inliner_.ReduceJSCall(calls[i], function);
+    if (r.Changed()) {
+      cumulative_count_ += function->shared()->ast_node_count();
+    }
+  }
+  return Replace(value);
+}
+
+
+// static
+int JSInliningHeuristic::CandidateSize(Candidate const& candidate) {
+  int size = 0;
+  for (int i = 0; i < candidate.num_functions; ++i) {
+    size += candidate.functions[i]->shared()->ast_node_count();
+  }
+  return size;
+}
+
+
 bool JSInliningHeuristic::CandidateCompare::operator()(
     const Candidate& left, const Candidate& right) const {
   if (left.calls != right.calls) {
@@ -142,14 +265,29 @@ bool JSInliningHeuristic::CandidateCompare::operator()(
 void JSInliningHeuristic::PrintCandidates() {
   PrintF("Candidates for inlining (size=%zu):\n", candidates_.size());
   for (const Candidate& candidate : candidates_) {
-    PrintF("  id:%d, calls:%d, size[source]:%d, size[ast]:%d / %s\n",
-           candidate.node->id(), candidate.calls,
-           candidate.function->shared()->SourceSize(),
-           candidate.function->shared()->ast_node_count(),
-           candidate.function->shared()->DebugName()->ToCString().get());
+    PrintF("  id:%d, calls:%d, targets:%d\n", candidate.node->id(),
+           candidate.calls, candidate.num_functions);
+    for (int i = 0; i < candidate.num_functions; ++i) {
+      Handle<SharedFunctionInfo> shared(candidate.functions[i]->shared());
+      PrintF("  - size[source]:%d, size[ast]:%d / %s\n", shared->SourceSize(),
+             shared->ast_node_count(), shared->DebugName()->ToCString().get());
+    }
   }
 }
 
+
+CommonOperatorBuilder* JSInliningHeuristic::common() const {
+  return jsgraph()->common();
+}
+
+
+Graph* JSInliningHeuristic::graph() const { return jsgraph()->graph(); }
+
+
+SimplifiedOperatorBuilder* JSInliningHeuristic::simplified() const {
+  return jsgraph()->simplified();
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -21,7 +21,8 @@ class JSInliningHeuristic final : public AdvancedReducer {
         inliner_(editor, local_zone, info, jsgraph),
         candidates_(local_zone),
         seen_(local_zone),
-        info_(info) {}
+        info_(info),
+        jsgraph_(jsgraph) {}
 
   Reduction Reduce(Node* node) final;
 
@@ -30,10 +31,15 @@ class JSInliningHeuristic final : public AdvancedReducer {
   void Finalize() final;
 
  private:
+  // This limits the number of call targets that are inlined at a single
+  // polymorphic call site.
+  static const int kMaxCallPolymorphism = 4;
+
   struct Candidate {
-    Handle<JSFunction> function;  // The call target being inlined.
-    Node* node;                   // The call site at which to inline.
-    int calls;                    // Number of times the call site was hit.
+    Handle<JSFunction> functions[kMaxCallPolymorphism];  // The call targets.
+    int num_functions;  // Number of call targets, 1 if monomorphic.
+    Node* node;         // The call site at which to inline.
+    int calls;          // Number of times the call site was hit.
   };
 
   // Comparator for candidates.
@@ -47,11 +53,27 @@ class JSInliningHeuristic final : public AdvancedReducer {
   // Dumps candidates to console.
   void PrintCandidates();
 
+  // Checks the size and kind limits of the heuristic for {function}.
+  bool CanInlineFunction(Handle<JSFunction> function) const;
+
+  // Inlines the call targets of {candidate}, dispatching on the identity of
+  // the callee first if there is more than one.
+  Reduction InlineCandidate(Candidate const& candidate);
+
+  // Computes the cumulative AST size of the call targets of {candidate}.
+  static int CandidateSize(Candidate const& candidate);
+
+  CommonOperatorBuilder* common() const;
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  SimplifiedOperatorBuilder* simplified() const;
+
   Mode const mode_;
   JSInliner inliner_;
   Candidates candidates_;
   ZoneSet<NodeId> seen_;
   CompilationInfo* info_;
+  JSGraph* const jsgraph_;
   int cumulative_count_ = 0;
 };
 
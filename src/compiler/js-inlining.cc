@@ -388,8 +388,9 @@ Reduction JSInliner::ReduceJSCall(Node* node, Handle<JSFunction> function) {
         shared_info->DebugName()->ToCString().get(),
         info_->shared_info()->DebugName()->ToCString().get());
 
-  // If function was lazily compiled, it's literals array may not yet be set up.
-  JSFunction::EnsureLiterals(function);
+  // If function was lazily compiled, it's literals array may not yet be set up,
+  // and an interpreted function may not have its feedback vector yet.
+  JSFunction::EnsureFeedbackVector(function);
 
   // Create the subgraph for the inlinee.
   Node* start;
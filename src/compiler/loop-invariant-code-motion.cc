@@ -0,0 +1,263 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+namespace {
+
+// Checks whether {object} is an allocation that happens inside of the loop
+// being analyzed, in which case stores to it cannot alias any of the loop
+// invariant objects.
+bool IsFreshAllocation(Node* object) {
+  if (object->opcode() == IrOpcode::kFinishRegion) {
+    object = NodeProperties::GetValueInput(object, 0);
+  }
+  return object->opcode() == IrOpcode::kAllocate;
+}
+
+int FieldSizeOf(FieldAccess const& access) {
+  return 1 << ElementSizeLog2Of(access.machine_type.representation());
+}
+
+}  // namespace
+
+class LoopInvariantCodeMotion::LoopKills final {
+ public:
+  explicit LoopKills(Zone* zone) : fields_(zone), elements_(false) {}
+
+  void KillField(FieldAccess const& access) {
+    fields_.push_back(
+        std::make_pair(access.offset, access.offset + FieldSizeOf(access)));
+  }
+  void KillElements() { elements_ = true; }
+
+  bool KillsField(FieldAccess const& access) const {
+    if (access.base_is_tagged == kUntaggedBase && elements_) return true;
+    int const size = FieldSizeOf(access);
+    for (std::pair<int, int> const& field : fields_) {
+      if (field.first < access.offset + size && access.offset < field.second) {
+        return true;
+      }
+    }
+    return false;
+  }
+  bool KillsElements() const { return elements_; }
+
+ private:
+  // Half-open byte ranges [start, end) of the fields stored to in the loop.
+  ZoneVector<std::pair<int, int>> fields_;
+  // Whether the loop stores to any elements or typed array backing stores.
+  bool elements_;
+};
+
+LoopInvariantCodeMotion::LoopInvariantCodeMotion(LoopTree* loop_tree,
+                                                 Zone* temp_zone)
+    : loop_tree_(loop_tree),
+      temp_zone_(temp_zone),
+      hoisted_(temp_zone) {}
+
+void LoopInvariantCodeMotion::Run() {
+  // Visit the loops in post order, so that nodes hoisted out of an inner loop
+  // can be hoisted further out of the enclosing loops.
+  ZoneVector<LoopTree::Loop*> stack(temp_zone());
+  ZoneVector<LoopTree::Loop*> order(temp_zone());
+  for (LoopTree::Loop* loop : loop_tree()->outer_loops()) {
+    stack.push_back(loop);
+  }
+  while (!stack.empty()) {
+    LoopTree::Loop* loop = stack.back();
+    stack.pop_back();
+    order.push_back(loop);
+    for (LoopTree::Loop* child : loop->children()) stack.push_back(child);
+  }
+  for (auto it = order.rbegin(); it != order.rend(); ++it) VisitLoop(*it);
+}
+
+void LoopInvariantCodeMotion::VisitLoop(LoopTree::Loop* loop) {
+  Node* const header = loop_tree()->HeaderNode(loop);
+  Node* effect_phi = nullptr;
+  for (Node* node : loop_tree()->HeaderNodes(loop)) {
+    if (node->opcode() == IrOpcode::kEffectPhi &&
+        NodeProperties::GetControlInput(node) == header) {
+      effect_phi = node;
+      break;
+    }
+  }
+  if (effect_phi == nullptr) return;
+
+  LoopKills kills(temp_zone());
+  if (!ComputeLoopKills(loop_tree(), loop, &kills)) return;
+  bool const has_checkpoint =
+      HasCheckpointAtEntry(effect_phi->InputAt(kAssumedLoopEntryIndex));
+
+  // Walk the effect chain from the loop header for as long as the nodes on
+  // it are controlled by the loop header, hoisting the invariant ones.
+  Node* current = effect_phi;
+  while (true) {
+    Node* next = nullptr;
+    for (Edge edge : current->use_edges()) {
+      Node* const user = edge.from();
+      if (!NodeProperties::IsEffectEdge(edge)) continue;
+      if (user == effect_phi || user->opcode() == IrOpcode::kTerminate) {
+        continue;
+      }
+      if (user->op()->ControlInputCount() != 1 ||
+          NodeProperties::GetControlInput(user) != header) {
+        continue;
+      }
+      if (next != nullptr) return;
+      next = user;
+    }
+    if (next == nullptr) return;
+    if (CanHoist(loop, kills, next, has_checkpoint)) {
+      Hoist(loop, next, effect_phi);
+      continue;
+    }
+    // Invariant nodes can be moved across checkpoints and loads, but we stop
+    // at the first node that might deoptimize or have a side effect.
+    switch (next->opcode()) {
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kLoadField:
+      case IrOpcode::kLoadElement:
+      case IrOpcode::kLoadBuffer:
+        current = next;
+        break;
+      default:
+        return;
+    }
+  }
+}
+
+bool LoopInvariantCodeMotion::CanHoist(LoopTree::Loop* loop,
+                                       LoopKills const& kills, Node* node,
+                                       bool has_checkpoint) const {
+  switch (node->opcode()) {
+    case IrOpcode::kLoadField:
+      if (kills.KillsField(FieldAccessOf(node->op()))) return false;
+      break;
+    case IrOpcode::kLoadElement:
+    case IrOpcode::kLoadBuffer:
+      if (kills.KillsElements()) return false;
+      break;
+    case IrOpcode::kCheckBounds:
+    case IrOpcode::kCheckIf:
+    case IrOpcode::kCheckNumber:
+    case IrOpcode::kCheckString:
+    case IrOpcode::kCheckTaggedPointer:
+    case IrOpcode::kCheckTaggedSigned:
+    case IrOpcode::kCheckFloat64Hole:
+    case IrOpcode::kCheckTaggedHole:
+    case IrOpcode::kCheckedUint32ToInt32:
+    case IrOpcode::kCheckedFloat64ToInt32:
+    case IrOpcode::kCheckedTaggedToInt32:
+    case IrOpcode::kCheckedTaggedToFloat64:
+    case IrOpcode::kCheckedTruncateTaggedToWord32:
+      // Eager deoptimization points need a checkpoint that dominates their
+      // new position without any side effects in between.
+      if (!has_checkpoint) return false;
+      break;
+    default:
+      return false;
+  }
+  for (int i = 0; i < node->op()->ValueInputCount(); ++i) {
+    if (!IsLoopInvariant(loop, NodeProperties::GetValueInput(node, i))) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool LoopInvariantCodeMotion::IsLoopInvariant(LoopTree::Loop* loop,
+                                              Node* node) const {
+  if (!loop_tree()->Contains(loop, node)) return true;
+  auto it = hoisted_.find(node);
+  return it != hoisted_.end() && it->second == loop;
+}
+
+void LoopInvariantCodeMotion::Hoist(LoopTree::Loop* loop, Node* node,
+                                    Node* effect_phi) {
+  Node* const header = loop_tree()->HeaderNode(loop);
+  TRACE("Hoisting #%d:%s out of loop #%d\n", node->id(), node->op()->mnemonic(),
+        header->id());
+
+  // Unlink {node} from the effect chain inside the loop.
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  for (Edge edge : node->use_edges()) {
+    if (NodeProperties::IsEffectEdge(edge)) edge.UpdateTo(effect);
+  }
+
+  // And relink it right before the loop entry.
+  NodeProperties::ReplaceEffectInput(
+      node, effect_phi->InputAt(kAssumedLoopEntryIndex));
+  NodeProperties::ReplaceControlInput(
+      node, header->InputAt(kAssumedLoopEntryIndex));
+  effect_phi->ReplaceInput(kAssumedLoopEntryIndex, node);
+  hoisted_[node] = loop;
+}
+
+// static
+bool LoopInvariantCodeMotion::ComputeLoopKills(LoopTree* loop_tree,
+                                               LoopTree::Loop* loop,
+                                               LoopKills* kills) {
+  for (Node* node : loop_tree->LoopNodes(loop)) {
+    if (node->op()->EffectOutputCount() == 0) continue;
+    if (node->op()->HasProperty(Operator::kNoWrite)) continue;
+    switch (node->opcode()) {
+      case IrOpcode::kStoreField: {
+        FieldAccess const& access = FieldAccessOf(node->op());
+        if (IsFreshAllocation(NodeProperties::GetValueInput(node, 0))) break;
+        if (access.base_is_tagged != kTaggedBase) return false;
+        kills->KillField(access);
+        break;
+      }
+      case IrOpcode::kStoreElement:
+        if (IsFreshAllocation(NodeProperties::GetValueInput(node, 0))) break;
+        kills->KillElements();
+        break;
+      case IrOpcode::kStoreBuffer:
+        kills->KillElements();
+        break;
+      case IrOpcode::kLoopExitEffect:
+        break;
+      default:
+        // Calls and other operations with arbitrary side effects.
+        return false;
+    }
+  }
+  return true;
+}
+
+// static
+bool LoopInvariantCodeMotion::HasCheckpointAtEntry(Node* effect) {
+  // The effect control linearizer wires eager deoptimization points to the
+  // frame state of the closest checkpoint, provided that there is no write
+  // in between.
+  while (effect->opcode() != IrOpcode::kCheckpoint) {
+    if (effect->op()->EffectInputCount() != 1) return false;
+    if (!effect->op()->HasProperty(Operator::kNoWrite)) return false;
+    if (effect->opcode() == IrOpcode::kFinishRegion) return false;
+    effect = NodeProperties::GetEffectInput(effect);
+  }
+  return true;
+}
+
+#undef TRACE
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
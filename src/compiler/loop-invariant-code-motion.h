@@ -0,0 +1,60 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+#define V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
+
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Hoists loop invariant loads and checks out of loops. The scheduler already
+// floats pure nodes out of loops, so this pass deals with the nodes that are
+// pinned to the effect chain. A node is hoisted from a loop if
+//
+//  (a) it is part of the straight-line prefix of the loop's effect chain that
+//      is controlled by the loop header itself, i.e. it is executed at least
+//      once whenever the loop is entered,
+//  (b) all of its value inputs are defined outside of the loop, and
+//  (c) nothing inside the loop writes to the memory it reads.
+//
+// Hoisted nodes are placed on the effect chain right before the loop entry;
+// checks are only hoisted if that position is covered by a checkpoint.
+class LoopInvariantCodeMotion final {
+ public:
+  LoopInvariantCodeMotion(LoopTree* loop_tree, Zone* temp_zone);
+
+  // Processes all loops in the {loop_tree}, inner loops first.
+  void Run();
+
+ private:
+  // Summary of the memory written inside of a single loop.
+  class LoopKills;
+
+  void VisitLoop(LoopTree::Loop* loop);
+  bool CanHoist(LoopTree::Loop* loop, LoopKills const& kills, Node* node,
+                bool has_checkpoint) const;
+  bool IsLoopInvariant(LoopTree::Loop* loop, Node* node) const;
+  void Hoist(LoopTree::Loop* loop, Node* node, Node* effect_phi);
+
+  static bool ComputeLoopKills(LoopTree* loop_tree, LoopTree::Loop* loop,
+                               LoopKills* kills);
+  static bool HasCheckpointAtEntry(Node* effect);
+
+  LoopTree* loop_tree() const { return loop_tree_; }
+  Zone* temp_zone() const { return temp_zone_; }
+
+  LoopTree* const loop_tree_;
+  Zone* const temp_zone_;
+  // Maps hoisted nodes to the loop they were most recently hoisted from.
+  ZoneMap<Node*, LoopTree::Loop*> hoisted_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_INVARIANT_CODE_MOTION_H_
@@ -0,0 +1,560 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorizer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/conversions-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+#define TRACE(...)                                  \
+  do {                                              \
+    if (FLAG_trace_turbo_loop) PrintF(__VA_ARGS__); \
+  } while (false)
+
+namespace {
+
+// Number of scalar iterations done by a single vector iteration.
+const int kLanes = 4;
+
+// Size of a single lane in bytes.
+const int kLaneSizeLog2 = 2;
+const int kLaneSize = 1 << kLaneSizeLog2;
+
+bool IsVectorizableAccess(ElementAccess const& access) {
+  // Typed arrays with external backing stores, see JSTypedLowering.
+  if (access.base_is_tagged != kUntaggedBase || access.header_size != 0) {
+    return false;
+  }
+  MachineRepresentation const rep = access.machine_type.representation();
+  return rep == MachineRepresentation::kFloat32 ||
+         rep == MachineRepresentation::kWord32;
+}
+
+}  // namespace
+
+LoopVectorizer::LoopVectorizer(JSGraph* jsgraph, LoopTree* loop_tree,
+                               Zone* temp_zone)
+    : jsgraph_(jsgraph),
+      loop_tree_(loop_tree),
+      temp_zone_(temp_zone),
+      loop_(nullptr),
+      induction_(nullptr),
+      vector_induction_(nullptr),
+      loads_(temp_zone),
+      vectors_(temp_zone),
+      splats_(temp_zone) {}
+
+void LoopVectorizer::Run() {
+  ZoneVector<LoopTree::Loop*> stack(temp_zone());
+  for (LoopTree::Loop* loop : loop_tree()->outer_loops()) {
+    stack.push_back(loop);
+  }
+  while (!stack.empty()) {
+    LoopTree::Loop* loop = stack.back();
+    stack.pop_back();
+    if (loop->children().empty()) {
+      loads_.clear();
+      vectors_.clear();
+      splats_.clear();
+      loop_ = loop;
+      Node* const header = loop_tree()->HeaderNode(loop);
+      if (VisitLoop(loop)) {
+        TRACE("Vectorized loop #%d\n", header->id());
+      } else {
+        TRACE("Loop #%d not vectorized\n", header->id());
+      }
+    }
+    for (LoopTree::Loop* child : loop->children()) stack.push_back(child);
+  }
+}
+
+bool LoopVectorizer::VisitLoop(LoopTree::Loop* loop) {
+  Node* const header = loop_tree()->HeaderNode(loop);
+  if (header->InputCount() != 2) return false;
+
+  // The only values carried across iterations must be the induction variable
+  // {i} (with i' = i + 1) and the effect.
+  Node* effect_phi = nullptr;
+  induction_ = nullptr;
+  for (Node* use : header->uses()) {
+    if (use->opcode() == IrOpcode::kPhi) {
+      if (induction_ != nullptr) return false;
+      induction_ = use;
+    } else if (use->opcode() == IrOpcode::kEffectPhi) {
+      effect_phi = use;
+    }
+  }
+  if (induction_ == nullptr || effect_phi == nullptr) return false;
+  if (PhiRepresentationOf(induction_->op()) != MachineRepresentation::kWord32) {
+    return false;
+  }
+  Node* const step = induction_->InputAt(1);
+  if (step->opcode() != IrOpcode::kInt32Add) return false;
+  Int32BinopMatcher mstep(step);
+  if (mstep.left().node() != induction_ || !mstep.right().Is(1)) return false;
+
+  // Walk the control chain of the body, which must consist of the loop exit
+  // test i < n at the top, and otherwise only of stack checks.
+  ZoneSet<Node*> controls(temp_zone());
+  ZoneSet<Node*> guarded(temp_zone());
+  Node* branch = nullptr;
+  for (Node* control = header;;) {
+    Node* next = nullptr;
+    for (Edge edge : control->use_edges()) {
+      Node* const user = edge.from();
+      if (!NodeProperties::IsControlEdge(edge)) continue;
+      if (user->op()->ControlOutputCount() == 0) continue;
+      if (!IsInLoop(user)) {
+        if (control == branch && user->opcode() == IrOpcode::kIfFalse) continue;
+        return false;
+      }
+      if (next != nullptr) return false;
+      next = user;
+    }
+    if (next == nullptr) return false;
+    if (next == header) break;
+    switch (next->opcode()) {
+      case IrOpcode::kBranch:
+        if (branch != nullptr) return false;
+        branch = next;
+        break;
+      case IrOpcode::kIfTrue:
+        if (branch == nullptr || next->InputAt(0) != branch) return false;
+        break;
+      case IrOpcode::kIfSuccess:
+      case IrOpcode::kJSStackCheck:
+        break;
+      default:
+        return false;
+    }
+    controls.insert(next);
+    if (branch != nullptr && next != branch) guarded.insert(next);
+    control = next;
+  }
+  if (branch == nullptr) return false;
+  Node* const condition = branch->InputAt(0);
+  if (condition->opcode() != IrOpcode::kInt32LessThan &&
+      condition->opcode() != IrOpcode::kUint32LessThan) {
+    return false;
+  }
+  Node* const limit = condition->InputAt(1);
+  if (condition->InputAt(0) != induction_ || IsInLoop(limit)) return false;
+
+  // Walk the effect chain of the body, which may only consist of element
+  // accesses, checkpoints and stack checks.
+  ZoneVector<Node*> effects(temp_zone());
+  ZoneVector<Access> accesses(temp_zone());
+  bool has_store = false;
+  for (Node* effect = effect_phi;;) {
+    Node* next = nullptr;
+    for (Edge edge : effect->use_edges()) {
+      Node* const user = edge.from();
+      if (!NodeProperties::IsEffectEdge(edge)) continue;
+      if (user->opcode() == IrOpcode::kTerminate) continue;
+      if (!IsInLoop(user)) {
+        // Only the loop exit continues with the effect of the header.
+        if (effect == effect_phi) continue;
+        return false;
+      }
+      if (next != nullptr) return false;
+      next = user;
+    }
+    if (next == nullptr) return false;
+    if (next == effect_phi) break;
+    switch (next->opcode()) {
+      case IrOpcode::kCheckpoint:
+      case IrOpcode::kJSStackCheck:
+        break;
+      case IrOpcode::kStoreElement:
+        if (ElementAccessOf(next->op()).write_barrier_kind != kNoWriteBarrier) {
+          return false;
+        }
+        has_store = true;
+      // Fall through.
+      case IrOpcode::kLoadElement: {
+        Access access = {next, 0, 0};
+        IntPtrMatcher mbase(next->InputAt(0));
+        if (!IsVectorizableAccess(ElementAccessOf(next->op())) ||
+            !mbase.HasValue() ||
+            !MatchIndex(next->InputAt(1), &access.offset) ||
+            guarded.count(NodeProperties::GetControlInput(next)) == 0) {
+          return false;
+        }
+        access.base = static_cast<intptr_t>(mbase.Value());
+        accesses.push_back(access);
+        if (next->opcode() == IrOpcode::kLoadElement) loads_[next] = false;
+        break;
+      }
+      default:
+        return false;
+    }
+    effects.push_back(next);
+    effect = next;
+  }
+  if (!has_store) return false;
+
+  // Make sure that nothing else happens inside of the loop, and that no value
+  // except for the induction variable is used after the loop.
+  for (Node* node : loop_tree()->LoopNodes(loop)) {
+    if (node == header || node == effect_phi || node == induction_) continue;
+    if (node->op()->ControlOutputCount() > 0 && controls.count(node) == 0) {
+      return false;
+    }
+    if (node->op()->EffectOutputCount() > 0 &&
+        std::find(effects.begin(), effects.end(), node) == effects.end()) {
+      return false;
+    }
+    for (Edge edge : node->use_edges()) {
+      if (NodeProperties::IsValueEdge(edge) && !IsInLoop(edge.from())) {
+        return false;
+      }
+    }
+  }
+
+  // Vector iteration {k} reads and writes lane {l} of each access exactly
+  // where scalar iteration {4 * k + l} does, but does all reads and writes of
+  // one access at once. That only changes the observable behavior if two
+  // accesses (one of them a store) overlap within a single vector iteration,
+  // but not at the same lane.
+  for (size_t i = 0; i < accesses.size(); ++i) {
+    for (size_t j = i + 1; j < accesses.size(); ++j) {
+      Access const& a = accesses[i];
+      Access const& b = accesses[j];
+      if (a.node->opcode() == IrOpcode::kLoadElement &&
+          b.node->opcode() == IrOpcode::kLoadElement) {
+        continue;
+      }
+      int64_t const distance =
+          (static_cast<int64_t>(a.base) + int64_t{kLaneSize} * a.offset) -
+          (static_cast<int64_t>(b.base) + int64_t{kLaneSize} * b.offset);
+      if (distance != 0 && std::abs(distance) < kLanes * kLaneSize) {
+        return false;
+      }
+    }
+  }
+
+  // Check that all stored values can be computed lane-wise.
+  for (Node* node : effects) {
+    if (node->opcode() != IrOpcode::kStoreElement) continue;
+    MachineRepresentation const rep =
+        ElementAccessOf(node->op()).machine_type.representation();
+    LaneKind const kind = rep == MachineRepresentation::kFloat32
+                              ? kFloat32Lanes
+                              : kWord32Lanes;
+    if (!CanVectorize(node->InputAt(2), kind)) return false;
+  }
+
+  // Build the vector loop in front of the scalar loop, i.e.
+  //
+  //   for (; i < n && n - i >= 4; i += 4) <vector body>
+  //   for (; i < n; ++i) <scalar body>
+  //
+  // where n - i is computed as uint32 to avoid overflow when i is negative.
+  Node* const entry = header->InputAt(0);
+  Node* const vector_header = graph()->NewNode(common()->Loop(2), entry, entry);
+  vector_induction_ = graph()->NewNode(
+      common()->Phi(MachineRepresentation::kWord32, 2), induction_->InputAt(0),
+      induction_->InputAt(0), vector_header);
+  Node* const vector_effect_phi =
+      graph()->NewNode(common()->EffectPhi(2), effect_phi->InputAt(0),
+                       effect_phi->InputAt(0), vector_header);
+  Node* check = graph()->NewNode(condition->op(), vector_induction_, limit);
+  Node* const remaining =
+      graph()->NewNode(machine()->Int32Sub(), limit, vector_induction_);
+  check = graph()->NewNode(
+      machine()->Word32And(), check,
+      graph()->NewNode(machine()->Uint32LessThan(),
+                       jsgraph()->Int32Constant(kLanes - 1), remaining));
+  Node* const vector_branch = graph()->NewNode(
+      common()->Branch(BranchHint::kTrue), check, vector_header);
+  Node* const control = graph()->NewNode(common()->IfTrue(), vector_branch);
+  Node* const exit = graph()->NewNode(common()->IfFalse(), vector_branch);
+
+  // Stack checks and checkpoints are dropped from the vector body. The vector
+  // loop cannot run longer than the typed arrays are, and the scalar loop
+  // still does a stack check on every iteration.
+  Node* effect = vector_effect_phi;
+  size_t index = 0;
+  for (Node* node : effects) {
+    if (node->opcode() != IrOpcode::kLoadElement &&
+        node->opcode() != IrOpcode::kStoreElement) {
+      continue;
+    }
+    Access const& access = accesses[index++];
+    if (node->opcode() == IrOpcode::kLoadElement) {
+      // Loads that none of the stored values depend on are just skipped.
+      if (!loads_[node]) continue;
+      effect = graph()->NewNode(machine()->Load(MachineType::Simd128()),
+                                node->InputAt(0),
+                                ComputeIndex(access), effect,
+                                control);
+      vectors_[node] = effect;
+    } else {
+      MachineRepresentation const rep =
+          ElementAccessOf(node->op()).machine_type.representation();
+      Node* const value =
+          Vectorize(node->InputAt(2), rep == MachineRepresentation::kFloat32
+                                          ? kFloat32Lanes
+                                          : kWord32Lanes);
+      effect = graph()->NewNode(
+          machine()->Store(StoreRepresentation(MachineRepresentation::kSimd128,
+                                               kNoWriteBarrier)),
+          node->InputAt(0), ComputeIndex(access), value,
+          effect, control);
+    }
+  }
+  vector_header->ReplaceInput(1, control);
+  vector_effect_phi->ReplaceInput(1, effect);
+  vector_induction_->ReplaceInput(
+      1, graph()->NewNode(machine()->Int32Add(), vector_induction_,
+                          jsgraph()->Int32Constant(kLanes)));
+
+  // Continue with the scalar loop for the remaining iterations.
+  header->ReplaceInput(0, exit);
+  effect_phi->ReplaceInput(0, vector_effect_phi);
+  induction_->ReplaceInput(0, vector_induction_);
+  return true;
+}
+
+bool LoopVectorizer::CanVectorize(Node* node, LaneKind kind) {
+  // Loop invariant values are broadcast to all lanes.
+  if (!IsInLoop(node)) return true;
+  switch (node->opcode()) {
+    case IrOpcode::kLoadElement: {
+      auto it = loads_.find(node);
+      if (it == loads_.end()) return false;
+      MachineRepresentation const rep =
+          ElementAccessOf(node->op()).machine_type.representation();
+      if ((rep == MachineRepresentation::kFloat32) != (kind == kFloat32Lanes)) {
+        return false;
+      }
+      it->second = true;
+      return true;
+    }
+    case IrOpcode::kTruncateFloat64ToFloat32:
+      return kind == kFloat32Lanes && CanVectorizeFloat64(node->InputAt(0));
+    case IrOpcode::kFloat32Add:
+    case IrOpcode::kFloat32Sub:
+    case IrOpcode::kFloat32Mul:
+    case IrOpcode::kFloat32Div:
+      return kind == kFloat32Lanes && CanVectorize(node->InputAt(0), kind) &&
+             CanVectorize(node->InputAt(1), kind);
+    case IrOpcode::kInt32Mul:
+      if (!machine()->Int32x4MulSupported()) return false;
+    // Fall through.
+    case IrOpcode::kInt32Add:
+    case IrOpcode::kInt32Sub:
+    case IrOpcode::kWord32And:
+    case IrOpcode::kWord32Or:
+    case IrOpcode::kWord32Xor:
+      return kind == kWord32Lanes && CanVectorize(node->InputAt(0), kind) &&
+             CanVectorize(node->InputAt(1), kind);
+    case IrOpcode::kWord32Shl:
+    case IrOpcode::kWord32Shr:
+    case IrOpcode::kWord32Sar: {
+      Int32Matcher mshift(node->InputAt(1));
+      return kind == kWord32Lanes && mshift.HasValue() &&
+             CanVectorize(node->InputAt(0), kind);
+    }
+    default:
+      return false;
+  }
+}
+
+bool LoopVectorizer::CanVectorizeFloat64(Node* node) {
+  // A single float64 operation on float32 inputs that is rounded to float32
+  // gives the same result as the float32 operation, but this doesn't hold
+  // for sequences of float64 operations.
+  switch (node->opcode()) {
+    case IrOpcode::kChangeFloat32ToFloat64:
+      return CanVectorize(node->InputAt(0), kFloat32Lanes);
+    case IrOpcode::kFloat64Add:
+    case IrOpcode::kFloat64Sub:
+    case IrOpcode::kFloat64Mul:
+    case IrOpcode::kFloat64Div:
+      return IsFloat32Exact(node->InputAt(0)) &&
+             IsFloat32Exact(node->InputAt(1));
+    default:
+      return false;
+  }
+}
+
+bool LoopVectorizer::IsFloat32Exact(Node* node) {
+  if (node->opcode() == IrOpcode::kChangeFloat32ToFloat64) {
+    return CanVectorize(node->InputAt(0), kFloat32Lanes);
+  }
+  Float64Matcher m(node);
+  return m.HasValue() &&
+         (std::isnan(m.Value()) || DoubleToFloat32(m.Value()) == m.Value());
+}
+
+Node* LoopVectorizer::Vectorize(Node* node, LaneKind kind) {
+  if (!IsInLoop(node)) return Splat(node, kind);
+  auto it = vectors_.find(node);
+  if (it != vectors_.end()) return it->second;
+  const Operator* op = nullptr;
+  switch (node->opcode()) {
+    case IrOpcode::kTruncateFloat64ToFloat32:
+      return vectors_[node] = VectorizeFloat64(node->InputAt(0));
+    case IrOpcode::kFloat32Add:
+      op = machine()->Float32x4Add();
+      break;
+    case IrOpcode::kFloat32Sub:
+      op = machine()->Float32x4Sub();
+      break;
+    case IrOpcode::kFloat32Mul:
+      op = machine()->Float32x4Mul();
+      break;
+    case IrOpcode::kFloat32Div:
+      op = machine()->Float32x4Div();
+      break;
+    case IrOpcode::kInt32Add:
+      op = machine()->Int32x4Add();
+      break;
+    case IrOpcode::kInt32Sub:
+      op = machine()->Int32x4Sub();
+      break;
+    case IrOpcode::kInt32Mul:
+      op = machine()->Int32x4Mul();
+      break;
+    case IrOpcode::kWord32And:
+      op = machine()->Simd128And();
+      break;
+    case IrOpcode::kWord32Or:
+      op = machine()->Simd128Or();
+      break;
+    case IrOpcode::kWord32Xor:
+      op = machine()->Simd128Xor();
+      break;
+    case IrOpcode::kWord32Shl:
+    case IrOpcode::kWord32Shr:
+    case IrOpcode::kWord32Sar: {
+      Int32Matcher mshift(node->InputAt(1));
+      op = node->opcode() == IrOpcode::kWord32Shl
+               ? machine()->Int32x4ShiftLeftByScalar()
+               : node->opcode() == IrOpcode::kWord32Shr
+                     ? machine()->Uint32x4ShiftRightByScalar()
+                     : machine()->Int32x4ShiftRightByScalar();
+      return vectors_[node] = graph()->NewNode(
+                 op, Vectorize(node->InputAt(0), kind),
+                 jsgraph()->Int32Constant(mshift.Value() & 0x1f));
+    }
+    default:
+      UNREACHABLE();
+      return nullptr;
+  }
+  return vectors_[node] =
+             graph()->NewNode(op, Vectorize(node->InputAt(0), kind),
+                              Vectorize(node->InputAt(1), kind));
+}
+
+Node* LoopVectorizer::VectorizeFloat64(Node* node) {
+  const Operator* op = nullptr;
+  switch (node->opcode()) {
+    case IrOpcode::kChangeFloat32ToFloat64:
+      return Vectorize(node->InputAt(0), kFloat32Lanes);
+    case IrOpcode::kFloat64Add:
+      op = machine()->Float32x4Add();
+      break;
+    case IrOpcode::kFloat64Sub:
+      op = machine()->Float32x4Sub();
+      break;
+    case IrOpcode::kFloat64Mul:
+      op = machine()->Float32x4Mul();
+      break;
+    case IrOpcode::kFloat64Div:
+      op = machine()->Float32x4Div();
+      break;
+    default:
+      UNREACHABLE();
+      return nullptr;
+  }
+  return graph()->NewNode(op, VectorizeFloat32Exact(node->InputAt(0)),
+                          VectorizeFloat32Exact(node->InputAt(1)));
+}
+
+Node* LoopVectorizer::VectorizeFloat32Exact(Node* node) {
+  if (node->opcode() == IrOpcode::kChangeFloat32ToFloat64) {
+    return Vectorize(node->InputAt(0), kFloat32Lanes);
+  }
+  Float64Matcher m(node);
+  DCHECK(m.HasValue());
+  return Splat(jsgraph()->Float32Constant(DoubleToFloat32(m.Value())),
+               kFloat32Lanes);
+}
+
+Node* LoopVectorizer::Splat(Node* node, LaneKind kind) {
+  auto it = splats_.find(node);
+  if (it != splats_.end()) return it->second;
+  const Operator* const op = kind == kFloat32Lanes
+                                 ? machine()->CreateFloat32x4()
+                                 : machine()->CreateInt32x4();
+  return splats_[node] = graph()->NewNode(op, node, node, node, node);
+}
+
+Node* LoopVectorizer::ComputeIndex(Access const& access) {
+  // Same as MemoryOptimizer::ComputeIndex, but for the vector induction
+  // variable.
+  Node* index = vector_induction_;
+  if (access.offset != 0) {
+    index = graph()->NewNode(machine()->Int32Add(), index,
+                             jsgraph()->Int32Constant(access.offset));
+  }
+  if (machine()->Is64()) {
+    index = graph()->NewNode(machine()->ChangeUint32ToUint64(), index);
+  }
+  return graph()->NewNode(machine()->WordShl(), index,
+                          jsgraph()->IntPtrConstant(kLaneSizeLog2));
+}
+
+bool LoopVectorizer::IsInLoop(Node* node) const {
+  return loop_tree()->Contains(loop_, node);
+}
+
+bool LoopVectorizer::MatchIndex(Node* index, int* offset) const {
+  if (index == induction_) {
+    *offset = 0;
+    return true;
+  }
+  if (index->opcode() != IrOpcode::kInt32Add &&
+      index->opcode() != IrOpcode::kInt32Sub) {
+    return false;
+  }
+  Int32BinopMatcher m(index);
+  if (m.left().node() != induction_ || !m.right().HasValue()) return false;
+  if (index->opcode() == IrOpcode::kInt32Add) {
+    *offset = m.right().Value();
+    return true;
+  }
+  if (m.right().Value() == kMinInt) return false;
+  *offset = -m.right().Value();
+  return true;
+}
+
+CommonOperatorBuilder* LoopVectorizer::common() const {
+  return jsgraph()->common();
+}
+
+Graph* LoopVectorizer::graph() const { return jsgraph()->graph(); }
+
+MachineOperatorBuilder* LoopVectorizer::machine() const {
+  return jsgraph()->machine();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
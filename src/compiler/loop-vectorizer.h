@@ -0,0 +1,92 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_VECTORIZER_H_
+#define V8_COMPILER_LOOP_VECTORIZER_H_
+
+#include "src/compiler/loop-analysis.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Forward declarations.
+class CommonOperatorBuilder;
+class Graph;
+class JSGraph;
+class MachineOperatorBuilder;
+
+// Vectorizes simple counted loops over typed arrays, i.e. loops like
+//
+//   for (var i = i0; i < n; ++i) a[i + c] = b[i + d] * 0.5 + ...
+//
+// whose body is a straight-line sequence of loads and stores of 32-bit
+// elements of typed arrays with constant backing stores, combined by
+// lane-wise arithmetic, without any values carried from one iteration to the
+// next besides the induction variable. Such a loop gets preceded by a vector
+// loop that does four iterations at a time using the 128-bit SIMD machine
+// operators, and the original loop is kept as the scalar epilogue. This runs
+// after representation selection, when the loop body consists of machine
+// operators and bounds checks are already gone.
+class LoopVectorizer final {
+ public:
+  LoopVectorizer(JSGraph* jsgraph, LoopTree* loop_tree, Zone* temp_zone);
+
+  // Processes all innermost loops of the {loop_tree}.
+  void Run();
+
+ private:
+  // Whether a vector holds four float32 or four word32 lanes.
+  enum LaneKind { kFloat32Lanes, kWord32Lanes };
+
+  // A load or store of a typed array element inside of the loop.
+  struct Access {
+    Node* node;
+    intptr_t base;  // The constant address of the backing store.
+    int offset;     // The element index is the induction variable + offset.
+  };
+
+  bool VisitLoop(LoopTree::Loop* loop);
+
+  // Checks whether the scalar {node} can be computed lane-wise, and records
+  // the loads it depends on in {loads_}.
+  bool CanVectorize(Node* node, LaneKind kind);
+  bool CanVectorizeFloat64(Node* node);
+  bool IsFloat32Exact(Node* node);
+
+  // Builds the vector equivalents of scalar nodes.
+  Node* Vectorize(Node* node, LaneKind kind);
+  Node* VectorizeFloat64(Node* node);
+  Node* VectorizeFloat32Exact(Node* node);
+  Node* Splat(Node* node, LaneKind kind);
+  Node* ComputeIndex(Access const& access);
+
+  bool IsInLoop(Node* node) const;
+  bool MatchIndex(Node* index, int* offset) const;
+
+  CommonOperatorBuilder* common() const;
+  Graph* graph() const;
+  JSGraph* jsgraph() const { return jsgraph_; }
+  MachineOperatorBuilder* machine() const;
+  LoopTree* loop_tree() const { return loop_tree_; }
+  Zone* temp_zone() const { return temp_zone_; }
+
+  JSGraph* const jsgraph_;
+  LoopTree* const loop_tree_;
+  Zone* const temp_zone_;
+
+  // State of the loop that is currently being vectorized.
+  LoopTree::Loop* loop_;
+  Node* induction_;
+  Node* vector_induction_;
+  ZoneMap<Node*, bool> loads_;  // Maps loads to whether they are needed.
+  ZoneMap<Node*, Node*> vectors_;
+  ZoneMap<Node*, Node*> splats_;
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_VECTORIZER_H_
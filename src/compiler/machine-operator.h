@@ -130,6 +130,9 @@ class MachineOperatorBuilder final : public ZoneObject {
     kWord64ReverseBits = 1u << 21,
     kFloat32Neg = 1u << 22,
     kFloat64Neg = 1u << 23,
+    // Lane-wise arithmetic on four 32-bit lanes and 128-bit loads and stores.
+    kSimd128Ops = 1u << 24,
+    kInt32x4Mul = 1u << 25,
     kAllOptionalOps =
         kFloat32Max | kFloat32Min | kFloat64Max | kFloat64Min |
         kFloat32RoundDown | kFloat64RoundDown | kFloat32RoundUp |
@@ -265,6 +268,11 @@ class MachineOperatorBuilder final : public ZoneObject {
   bool Int32DivIsSafe() const { return flags_ & kInt32DivIsSafe; }
   bool Uint32DivIsSafe() const { return flags_ & kUint32DivIsSafe; }
 
+  // The backend can generate code for the Float32x4 and Int32x4 operators
+  // used by the loop vectorizer, and for Int32x4Mul respectively.
+  bool Simd128OpsSupported() const { return flags_ & kSimd128Ops; }
+  bool Int32x4MulSupported() const { return flags_ & kInt32x4Mul; }
+
   const Operator* Int64Add();
   const Operator* Int64AddWithOverflow();
   const Operator* Int64Sub();
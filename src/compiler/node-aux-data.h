@@ -31,6 +31,8 @@ class NodeAuxData {
     return (id < aux_data_.size()) ? aux_data_[id] : T();
   }
 
+  void Clear() { aux_data_.clear(); }
+
   class const_iterator;
   friend class const_iterator;
 
@@ -320,7 +320,10 @@ class Node final {
     OutOfLineInputs* outline_;
   } inputs_;
 
+  void set_id(NodeId id) { bit_field_ = IdField::update(bit_field_, id); }
+
   friend class Edge;
+  friend class Graph;
   friend class NodeMarkerBase;
   friend class NodeProperties;
 
@@ -13,6 +13,7 @@
 #include "src/compiler/ast-graph-builder.h"
 #include "src/compiler/ast-loop-assignment-analyzer.h"
 #include "src/compiler/basic-block-instrumentor.h"
+#include "src/compiler/bounds-check-elimination.h"
 #include "src/compiler/branch-elimination.h"
 #include "src/compiler/bytecode-graph-builder.h"
 #include "src/compiler/checkpoint-elimination.h"
@@ -44,7 +45,9 @@
 #include "src/compiler/live-range-separator.h"
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-invariant-code-motion.h"
 #include "src/compiler/loop-peeling.h"
+#include "src/compiler/loop-vectorizer.h"
 #include "src/compiler/loop-variable-optimizer.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/memory-optimizer.h"
@@ -923,6 +926,13 @@ struct TypedLoweringPhase {
     AddReducer(data, &graph_reducer, &checkpoint_elimination);
     AddReducer(data, &graph_reducer, &common_reducer);
     graph_reducer.ReduceGraph();
+
+    // Typed lowering leaves a lot of JS-level nodes behind; trim them right
+    // away instead of dragging them along until the late trimming.
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
   }
 };
 
@@ -940,6 +950,12 @@ struct EscapeAnalysisPhase {
     AddReducer(data, &graph_reducer, &escape_reducer);
     graph_reducer.ReduceGraph();
     escape_reducer.VerifyReplacement();
+
+    // Trim the allocations and field accesses that were replaced.
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
   }
 };
 
@@ -1085,6 +1101,50 @@ struct LoadEliminationPhase {
   }
 };
 
+struct BoundsCheckEliminationPhase {
+  static const char* phase_name() { return "bounds check elimination"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    JSGraphReducer graph_reducer(data->jsgraph(), temp_zone);
+    BoundsCheckElimination bounds_check_elimination(&graph_reducer,
+                                                    data->jsgraph());
+    AddReducer(data, &graph_reducer, &bounds_check_elimination);
+    graph_reducer.ReduceGraph();
+  }
+};
+
+struct LoopInvariantCodeMotionPhase {
+  static const char* phase_name() { return "loop invariant code motion"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(data->jsgraph()->graph(), temp_zone);
+    LoopInvariantCodeMotion licm(loop_tree, temp_zone);
+    licm.Run();
+  }
+};
+
+struct LoopVectorizationPhase {
+  static const char* phase_name() { return "loop vectorization"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(data->jsgraph()->graph(), temp_zone);
+    LoopVectorizer vectorizer(data->jsgraph(), loop_tree, temp_zone);
+    vectorizer.Run();
+  }
+};
+
 struct MemoryOptimizationPhase {
   static const char* phase_name() { return "memory optimization"; }
 
@@ -1146,6 +1206,25 @@ struct LateGraphTrimmingPhase {
     NodeVector roots(temp_zone);
     data->jsgraph()->GetCachedNodes(&roots);
     trimmer.TrimGraph(roots.begin(), roots.end());
+
+    // Renumber the surviving nodes densely, so that the node-indexed side
+    // tables of the scheduler, the instruction selector and the register
+    // allocator only pay for live nodes. The visualizer relies on stable node
+    // ids across phases, so keep them when tracing.
+    if (FLAG_trace_turbo) return;
+    SourcePositionTable* source_positions = data->source_positions();
+    NodeVector const& live = trimmer.live();
+    ZoneVector<SourcePosition> positions(temp_zone);
+    positions.reserve(live.size());
+    for (Node* const node : live) {
+      positions.push_back(source_positions->GetSourcePosition(node));
+    }
+    data->graph()->RenumberNodes(live);
+    source_positions->Clear();
+    for (size_t i = 0; i < live.size(); ++i) {
+      if (positions[i].IsUnknown()) continue;
+      source_positions->SetSourcePosition(live[i], positions[i]);
+    }
   }
 };
 
@@ -1504,6 +1583,16 @@ bool PipelineImpl::CreateGraph() {
       Run<LoadEliminationPhase>();
       RunPrintAndVerify("Load eliminated");
     }
+
+    if (FLAG_turbo_bounds_check_elimination) {
+      Run<BoundsCheckEliminationPhase>();
+      RunPrintAndVerify("Bounds checks eliminated");
+    }
+
+    if (FLAG_turbo_licm) {
+      Run<LoopInvariantCodeMotionPhase>();
+      RunPrintAndVerify("Loop invariants hoisted");
+    }
   }
 
   // Select representations. This has to run w/o the Typer decorator, because
@@ -1512,6 +1601,11 @@ bool PipelineImpl::CreateGraph() {
   Run<RepresentationSelectionPhase>();
   RunPrintAndVerify("Representations selected", true);
 
+  if (FLAG_turbo_loop_vectorization && data->machine()->Simd128OpsSupported()) {
+    Run<LoopVectorizationPhase>();
+    RunPrintAndVerify("Loops vectorized", true);
+  }
+
 #ifdef DEBUG
   // From now on it is invalid to look at types on the nodes, because:
   //
@@ -1849,14 +1943,20 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
               ->RangesDefinedInDeferredStayInDeferred());
   }
 
-  if (FLAG_turbo_preprocess_ranges) {
+  // Very large functions (i.e. asm.js modules or generated code) skip the
+  // splintering and move optimization heuristics, whose compile time cost
+  // would otherwise delay tier-up considerably.
+  bool const fast_mode = data->sequence()->LastInstructionIndex() >=
+                         FLAG_turbo_fast_register_allocation_threshold;
+
+  if (FLAG_turbo_preprocess_ranges && !fast_mode) {
     Run<SplinterLiveRangesPhase>();
   }
 
   Run<AllocateGeneralRegistersPhase<LinearScanAllocator>>();
   Run<AllocateFPRegistersPhase<LinearScanAllocator>>();
 
-  if (FLAG_turbo_preprocess_ranges) {
+  if (FLAG_turbo_preprocess_ranges && !fast_mode) {
     Run<MergeSplintersPhase>();
   }
 
@@ -1866,7 +1966,7 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
   Run<PopulateReferenceMapsPhase>();
   Run<ConnectRangesPhase>();
   Run<ResolveControlFlowPhase>();
-  if (FLAG_turbo_move_optimization) {
+  if (FLAG_turbo_move_optimization && !fast_mode) {
     Run<OptimizeMovesPhase>();
   }
 
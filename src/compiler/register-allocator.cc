@@ -777,6 +777,22 @@ LifetimePosition LiveRange::FirstIntersection(LiveRange* other) const {
   return LifetimePosition::Invalid();
 }
 
+LifetimePosition LiveRange::NextStartAfter(LifetimePosition position) const {
+  for (UseInterval* interval = FirstSearchIntervalForPosition(position);
+       interval != nullptr; interval = interval->next()) {
+    if (interval->start() >= position) return interval->start();
+  }
+  return LifetimePosition::MaxPosition();
+}
+
+LifetimePosition LiveRange::NextEndAfter(LifetimePosition position) const {
+  for (UseInterval* interval = FirstSearchIntervalForPosition(position);
+       interval != nullptr; interval = interval->next()) {
+    if (interval->end() > position) return interval->end();
+  }
+  return LifetimePosition::MaxPosition();
+}
+
 void LiveRange::Print(const RegisterConfiguration* config,
                       bool with_children) const {
   OFStream os(stdout);
@@ -2607,7 +2623,9 @@ LinearScanAllocator::LinearScanAllocator(RegisterAllocationData* data,
     : RegisterAllocator(data, kind),
       unhandled_live_ranges_(local_zone),
       active_live_ranges_(local_zone),
-      inactive_live_ranges_(local_zone) {
+      inactive_live_ranges_(local_zone),
+      next_active_ranges_change_(LifetimePosition::Invalid()),
+      next_inactive_ranges_change_(LifetimePosition::Invalid()) {
   unhandled_live_ranges().reserve(
       static_cast<size_t>(code()->VirtualRegisterCount() * 2));
   active_live_ranges().reserve(8);
@@ -2670,25 +2688,47 @@ void LinearScanAllocator::AllocateRegisters() {
     if (current->IsTopLevel() && TryReuseSpillForPhi(current->TopLevel()))
       continue;
 
-    for (size_t i = 0; i < active_live_ranges().size(); ++i) {
-      LiveRange* cur_active = active_live_ranges()[i];
-      if (cur_active->End() <= position) {
-        ActiveToHandled(cur_active);
-        --i;  // The live range was removed from the list of active live ranges.
-      } else if (!cur_active->Covers(position)) {
-        ActiveToInactive(cur_active);
-        --i;  // The live range was removed from the list of active live ranges.
+    // Only rescan the active and inactive sets once some range in them can
+    // change its state. This avoids quadratic behavior on large functions,
+    // where both sets hold many long-lived ranges.
+    if (position >= next_active_ranges_change_) {
+      next_active_ranges_change_ = LifetimePosition::MaxPosition();
+      for (size_t i = 0; i < active_live_ranges().size(); ++i) {
+        LiveRange* cur_active = active_live_ranges()[i];
+        if (cur_active->End() <= position) {
+          ActiveToHandled(cur_active);
+          --i;  // The live range was removed from the list of active ranges.
+        } else if (!cur_active->Covers(position)) {
+          ActiveToInactive(cur_active);
+          next_inactive_ranges_change_ =
+              Min(next_inactive_ranges_change_,
+                  cur_active->NextStartAfter(position));
+          --i;  // The live range was removed from the list of active ranges.
+        } else {
+          next_active_ranges_change_ = Min(next_active_ranges_change_,
+                                           cur_active->NextEndAfter(position));
+        }
       }
     }
 
-    for (size_t i = 0; i < inactive_live_ranges().size(); ++i) {
-      LiveRange* cur_inactive = inactive_live_ranges()[i];
-      if (cur_inactive->End() <= position) {
-        InactiveToHandled(cur_inactive);
-        --i;  // Live range was removed from the list of inactive live ranges.
-      } else if (cur_inactive->Covers(position)) {
-        InactiveToActive(cur_inactive);
-        --i;  // Live range was removed from the list of inactive live ranges.
+    if (position >= next_inactive_ranges_change_) {
+      next_inactive_ranges_change_ = LifetimePosition::MaxPosition();
+      for (size_t i = 0; i < inactive_live_ranges().size(); ++i) {
+        LiveRange* cur_inactive = inactive_live_ranges()[i];
+        if (cur_inactive->End() <= position) {
+          InactiveToHandled(cur_inactive);
+          --i;  // Live range was removed from the list of inactive ranges.
+        } else if (cur_inactive->Covers(position)) {
+          InactiveToActive(cur_inactive);
+          next_active_ranges_change_ =
+              Min(next_active_ranges_change_,
+                  cur_inactive->NextEndAfter(position));
+          --i;  // Live range was removed from the list of inactive ranges.
+        } else {
+          next_inactive_ranges_change_ =
+              Min(next_inactive_ranges_change_,
+                  cur_inactive->NextStartAfter(position));
+        }
       }
     }
 
@@ -2718,6 +2758,8 @@ void LinearScanAllocator::AddToActive(LiveRange* range) {
   TRACE("Add live range %d:%d to active\n", range->TopLevel()->vreg(),
         range->relative_id());
   active_live_ranges().push_back(range);
+  next_active_ranges_change_ = Min(next_active_ranges_change_,
+                                   range->NextEndAfter(range->Start()));
 }
 
 
@@ -2725,6 +2767,8 @@ void LinearScanAllocator::AddToInactive(LiveRange* range) {
   TRACE("Add live range %d:%d to inactive\n", range->TopLevel()->vreg(),
         range->relative_id());
   inactive_live_ranges().push_back(range);
+  next_inactive_ranges_change_ = Min(next_inactive_ranges_change_,
+                                     range->NextStartAfter(range->Start()));
 }
 
 
@@ -2732,20 +2776,19 @@ void LinearScanAllocator::AddToUnhandledSorted(LiveRange* range) {
   if (range == nullptr || range->IsEmpty()) return;
   DCHECK(!range->HasRegisterAssigned() && !range->spilled());
   DCHECK(allocation_finger_ <= range->Start());
-  for (int i = static_cast<int>(unhandled_live_ranges().size() - 1); i >= 0;
-       --i) {
-    LiveRange* cur_range = unhandled_live_ranges().at(i);
-    if (!range->ShouldBeAllocatedBefore(cur_range)) continue;
-    TRACE("Add live range %d:%d to unhandled at %d\n",
-          range->TopLevel()->vreg(), range->relative_id(), i + 1);
-    auto it = unhandled_live_ranges().begin() + (i + 1);
-    unhandled_live_ranges().insert(it, range);
-    DCHECK(UnhandledIsSorted());
-    return;
-  }
-  TRACE("Add live range %d:%d to unhandled at start\n",
-        range->TopLevel()->vreg(), range->relative_id());
-  unhandled_live_ranges().insert(unhandled_live_ranges().begin(), range);
+  // The unhandled ranges are sorted such that the ranges to be processed last
+  // come first, so {range} goes right after the last range that it should be
+  // allocated before. Binary search for that position, as the linear search
+  // made splitting quadratic for functions with many live ranges.
+  auto it = std::partition_point(
+      unhandled_live_ranges().begin(), unhandled_live_ranges().end(),
+      [range](LiveRange* cur_range) {
+        return range->ShouldBeAllocatedBefore(cur_range);
+      });
+  TRACE("Add live range %d:%d to unhandled at %d\n", range->TopLevel()->vreg(),
+        range->relative_id(),
+        static_cast<int>(it - unhandled_live_ranges().begin()));
+  unhandled_live_ranges().insert(it, range);
   DCHECK(UnhandledIsSorted());
 }
 
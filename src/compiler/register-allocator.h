@@ -402,6 +402,14 @@ class LiveRange : public ZoneObject {
   bool Covers(LifetimePosition position) const;
   LifetimePosition FirstIntersection(LiveRange* other) const;
 
+  // Returns the start of the first interval that starts at or after
+  // {position}, or MaxPosition() if there is no such interval.
+  LifetimePosition NextStartAfter(LifetimePosition position) const;
+
+  // Returns the end of the first interval that ends after {position}, or
+  // MaxPosition() if there is no such interval.
+  LifetimePosition NextEndAfter(LifetimePosition position) const;
+
   void VerifyChildStructure() const {
     VerifyIntervals();
     VerifyPositions();
@@ -1082,6 +1090,12 @@ class LinearScanAllocator final : public RegisterAllocator {
   ZoneVector<LiveRange*> active_live_ranges_;
   ZoneVector<LiveRange*> inactive_live_ranges_;
 
+  // The earliest positions at which a range in the active respectively the
+  // inactive set can change its state. Until the allocation reaches these
+  // positions, the sets don't need to be rescanned.
+  LifetimePosition next_active_ranges_change_;
+  LifetimePosition next_inactive_ranges_change_;
+
 #ifdef DEBUG
   LifetimePosition allocation_finger_;
 #endif
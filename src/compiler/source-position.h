@@ -71,6 +71,7 @@ class SourcePositionTable final : public ZoneObject {
 
   SourcePosition GetSourcePosition(Node* node) const;
   void SetSourcePosition(Node* node, SourcePosition position);
+  void Clear() { table_.Clear(); }
 
   void Print(std::ostream& os) const;
 
@@ -1729,6 +1729,59 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
       __ Xorpd(kScratchDoubleReg, kScratchDoubleReg);
       __ Subsd(i.InputDoubleRegister(0), kScratchDoubleReg);
       break;
+    case kSSEFloat32x4Splat: {
+      XMMRegister dst = i.OutputSimd128Register();
+      __ Movaps(dst, i.InputDoubleRegister(0));
+      __ shufps(dst, dst, 0);
+      break;
+    }
+    case kSSEFloat32x4Add:
+      __ addps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSEFloat32x4Sub:
+      __ subps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSEFloat32x4Mul:
+      __ mulps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSEFloat32x4Div:
+      __ divps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSEInt32x4Splat: {
+      XMMRegister dst = i.OutputSimd128Register();
+      __ Movd(dst, i.InputRegister(0));
+      __ pshufd(dst, dst, 0);
+      break;
+    }
+    case kSSEInt32x4Add:
+      __ paddd(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSEInt32x4Sub:
+      __ psubd(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSEInt32x4Mul: {
+      CpuFeatureScope sse_scope(masm(), SSE4_1);
+      __ pmulld(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    }
+    case kSSEInt32x4ShiftLeftByScalar:
+      __ pslld(i.OutputSimd128Register(), i.InputInt8(1));
+      break;
+    case kSSEInt32x4ShiftRightByScalar:
+      __ psrad(i.OutputSimd128Register(), i.InputInt8(1));
+      break;
+    case kSSEUint32x4ShiftRightByScalar:
+      __ psrld(i.OutputSimd128Register(), i.InputInt8(1));
+      break;
+    case kSSESimd128And:
+      __ andps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSESimd128Or:
+      __ orps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
+    case kSSESimd128Xor:
+      __ xorps(i.OutputSimd128Register(), i.InputSimd128Register(1));
+      break;
     case kX64Movsxbl:
       ASSEMBLE_MOVX(movsxbl);
       __ AssertZeroExtended(i.OutputRegister());
@@ -1821,6 +1874,15 @@ CodeGenerator::CodeGenResult CodeGenerator::AssembleArchInstruction(
         __ Movsd(operand, i.InputDoubleRegister(index));
       }
       break;
+    case kX64Movups:
+      if (instr->HasOutput()) {
+        __ Movups(i.OutputSimd128Register(), i.MemoryOperand());
+      } else {
+        size_t index = 0;
+        Operand operand = i.MemoryOperand(&index);
+        __ Movups(operand, i.InputSimd128Register(index));
+      }
+      break;
     case kX64BitcastFI:
       if (instr->InputAt(0)->IsFPStackSlot()) {
         __ movl(i.OutputRegister(), i.InputOperand(0));
@@ -101,6 +101,21 @@ namespace compiler {
   V(SSEFloat64InsertHighWord32)    \
   V(SSEFloat64LoadLowWord32)       \
   V(SSEFloat64SilenceNaN)          \
+  V(SSEFloat32x4Splat)             \
+  V(SSEFloat32x4Add)               \
+  V(SSEFloat32x4Sub)               \
+  V(SSEFloat32x4Mul)               \
+  V(SSEFloat32x4Div)               \
+  V(SSEInt32x4Splat)               \
+  V(SSEInt32x4Add)                 \
+  V(SSEInt32x4Sub)                 \
+  V(SSEInt32x4Mul)                 \
+  V(SSEInt32x4ShiftLeftByScalar)   \
+  V(SSEInt32x4ShiftRightByScalar)  \
+  V(SSEUint32x4ShiftRightByScalar) \
+  V(SSESimd128And)                 \
+  V(SSESimd128Or)                  \
+  V(SSESimd128Xor)                 \
   V(AVXFloat32Cmp)                 \
   V(AVXFloat32Add)                 \
   V(AVXFloat32Sub)                 \
@@ -126,6 +141,7 @@ namespace compiler {
   V(X64Movq)                       \
   V(X64Movsd)                      \
   V(X64Movss)                      \
+  V(X64Movups)                     \
   V(X64BitcastFI)                  \
   V(X64BitcastDL)                  \
   V(X64BitcastIF)                  \
@@ -4,6 +4,8 @@
 
 #include "src/compiler/instruction-scheduler.h"
 
+#include <algorithm>
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -103,6 +105,21 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kSSEFloat64InsertHighWord32:
     case kSSEFloat64LoadLowWord32:
     case kSSEFloat64SilenceNaN:
+    case kSSEFloat32x4Splat:
+    case kSSEFloat32x4Add:
+    case kSSEFloat32x4Sub:
+    case kSSEFloat32x4Mul:
+    case kSSEFloat32x4Div:
+    case kSSEInt32x4Splat:
+    case kSSEInt32x4Add:
+    case kSSEInt32x4Sub:
+    case kSSEInt32x4Mul:
+    case kSSEInt32x4ShiftLeftByScalar:
+    case kSSEInt32x4ShiftRightByScalar:
+    case kSSEUint32x4ShiftRightByScalar:
+    case kSSESimd128And:
+    case kSSESimd128Or:
+    case kSSESimd128Xor:
     case kAVXFloat32Cmp:
     case kAVXFloat32Add:
     case kAVXFloat32Sub:
@@ -154,6 +171,7 @@ int InstructionScheduler::GetTargetInstructionFlags(
     case kX64Movq:
     case kX64Movsd:
     case kX64Movss:
+    case kX64Movups:
       return instr->HasOutput() ? kIsLoadOperation : kHasSideEffect;
 
     case kX64StackCheck:
@@ -181,8 +199,215 @@ int InstructionScheduler::GetTargetInstructionFlags(
 
 
 int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // TODO(all): Add instruction cost modeling.
-  return 1;
+  // Basic latency modeling for x64 instructions. The numbers are taken from
+  // the published latency tables of recent out-of-order Intel and AMD cores;
+  // instructions that take a memory operand additionally pay the latency of
+  // the load.
+  const int kLoadLatency = 4;
+  int const load_latency =
+      instr->addressing_mode() == kMode_None ? 0 : kLoadLatency;
+  switch (instr->arch_opcode()) {
+    case kX64Add:
+    case kX64Add32:
+    case kX64And:
+    case kX64And32:
+    case kX64Cmp:
+    case kX64Cmp32:
+    case kX64Cmp16:
+    case kX64Cmp8:
+    case kX64Test:
+    case kX64Test32:
+    case kX64Test16:
+    case kX64Test8:
+    case kX64Or:
+    case kX64Or32:
+    case kX64Xor:
+    case kX64Xor32:
+    case kX64Sub:
+    case kX64Sub32:
+    case kX64Not:
+    case kX64Not32:
+    case kX64Neg:
+    case kX64Neg32:
+    case kX64Shl:
+    case kX64Shl32:
+    case kX64Shr:
+    case kX64Shr32:
+    case kX64Sar:
+    case kX64Sar32:
+    case kX64Ror:
+    case kX64Ror32:
+    case kX64Dec32:
+    case kX64Inc32:
+      return load_latency + 1;
+
+    case kX64Lea:
+    case kX64Lea32:
+      // Three component addresses go through the slow LEA unit.
+      switch (instr->addressing_mode()) {
+        case kMode_MR1I:
+        case kMode_MR2I:
+        case kMode_MR4I:
+        case kMode_MR8I:
+          return 3;
+        default:
+          return 1;
+      }
+
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+    case kX64Lzcnt:
+    case kX64Lzcnt32:
+    case kX64Tzcnt:
+    case kX64Tzcnt32:
+    case kX64Popcnt:
+    case kX64Popcnt32:
+      return load_latency + 3;
+
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return load_latency + 26;
+
+    case kX64Idiv:
+    case kX64Udiv:
+      return load_latency + 40;
+
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movsxlq:
+      return std::max(load_latency, 1);
+
+    case kX64Movl:
+    case kX64Movq:
+      return instr->HasOutput() ? std::max(load_latency, 1) : 1;
+
+    case kX64Movsd:
+    case kX64Movss:
+    case kX64Movups:
+      return instr->HasOutput() ? kLoadLatency + 1 : 1;
+
+    case kX64Movb:
+    case kX64Movw:
+    case kX64Push:
+    case kX64Poke:
+      return 1;
+
+    case kX64StackCheck:
+      return kLoadLatency + 1;
+
+    case kX64Xchgb:
+    case kX64Xchgw:
+    case kX64Xchgl:
+      return 20;
+
+    case kSSEFloat32Abs:
+    case kSSEFloat32Neg:
+    case kSSEFloat64Abs:
+    case kSSEFloat64Neg:
+    case kAVXFloat32Abs:
+    case kAVXFloat32Neg:
+    case kAVXFloat64Abs:
+    case kAVXFloat64Neg:
+    case kSSEInt32x4Add:
+    case kSSEInt32x4Sub:
+    case kSSEInt32x4ShiftLeftByScalar:
+    case kSSEInt32x4ShiftRightByScalar:
+    case kSSEUint32x4ShiftRightByScalar:
+    case kSSESimd128And:
+    case kSSESimd128Or:
+    case kSSESimd128Xor:
+      return load_latency + 1;
+
+    case kSSEFloat32Cmp:
+    case kSSEFloat64Cmp:
+    case kAVXFloat32Cmp:
+    case kAVXFloat64Cmp:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+      return load_latency + 3;
+
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Mul:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+    case kAVXFloat32Add:
+    case kAVXFloat32Sub:
+    case kAVXFloat32Mul:
+    case kAVXFloat64Add:
+    case kAVXFloat64Sub:
+    case kAVXFloat64Mul:
+    case kSSEFloat32x4Add:
+    case kSSEFloat32x4Sub:
+    case kSSEFloat32x4Mul:
+      return load_latency + 4;
+
+    case kSSEFloat32Div:
+    case kSSEFloat32x4Div:
+    case kAVXFloat32Div:
+      return load_latency + 11;
+
+    case kSSEFloat64Div:
+    case kAVXFloat64Div:
+      return load_latency + 14;
+
+    case kSSEFloat32Sqrt:
+      return load_latency + 12;
+
+    case kSSEFloat64Sqrt:
+      return load_latency + 18;
+
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+      return load_latency + 8;
+
+    case kSSEInt32x4Mul:
+      return load_latency + 10;
+
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToUint64:
+    case kSSEFloat64ToUint64:
+    case kSSEInt32ToFloat64:
+    case kSSEInt32ToFloat32:
+    case kSSEInt64ToFloat32:
+    case kSSEInt64ToFloat64:
+    case kSSEUint64ToFloat32:
+    case kSSEUint64ToFloat64:
+    case kSSEUint32ToFloat64:
+    case kSSEUint32ToFloat32:
+      return load_latency + 5;
+
+    case kSSEFloat64ExtractLowWord32:
+    case kSSEFloat64ExtractHighWord32:
+    case kSSEFloat64InsertLowWord32:
+    case kSSEFloat64InsertHighWord32:
+    case kSSEFloat64LoadLowWord32:
+    case kSSEFloat32x4Splat:
+    case kSSEInt32x4Splat:
+    case kX64BitcastFI:
+    case kX64BitcastDL:
+    case kX64BitcastIF:
+    case kX64BitcastLD:
+      return load_latency + 2;
+
+    case kSSEFloat64SilenceNaN:
+      return 4;
+
+    default:
+      return 1;
+  }
 }
 
 }  // namespace compiler
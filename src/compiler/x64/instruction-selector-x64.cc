@@ -173,7 +173,9 @@ void InstructionSelector::VisitLoad(Node* node) {
     case MachineRepresentation::kWord64:
       opcode = kX64Movq;
       break;
-    case MachineRepresentation::kSimd128:  // Fall through.
+    case MachineRepresentation::kSimd128:
+      opcode = kX64Movups;
+      break;
     case MachineRepresentation::kNone:
       UNREACHABLE();
       return;
@@ -258,7 +260,9 @@ void InstructionSelector::VisitStore(Node* node) {
       case MachineRepresentation::kWord64:
         opcode = kX64Movq;
         break;
-      case MachineRepresentation::kSimd128:  // Fall through.
+      case MachineRepresentation::kSimd128:
+        opcode = kX64Movups;
+        break;
       case MachineRepresentation::kNone:
         UNREACHABLE();
         return;
@@ -2110,6 +2114,104 @@ void InstructionSelector::VisitFloat64SilenceNaN(Node* node) {
        g.UseRegister(node->InputAt(0)));
 }
 
+namespace {
+
+// Shared routine for lane-wise SIMD binops. The operands are always kept in
+// registers, since the memory operands of the packed SSE instructions must
+// be 16-byte aligned.
+void VisitSimd128Binop(InstructionSelector* selector, Node* node,
+                       ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  selector->Emit(opcode, g.DefineSameAsFirst(node),
+                 g.UseRegister(node->InputAt(0)),
+                 g.UseRegister(node->InputAt(1)));
+}
+
+// Shared routine for SIMD shifts of all lanes by a constant amount.
+void VisitSimd128Shift(InstructionSelector* selector, Node* node,
+                       ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  Int32Matcher mshift(node->InputAt(1));
+  CHECK(mshift.HasValue());
+  selector->Emit(opcode, g.DefineSameAsFirst(node),
+                 g.UseRegister(node->InputAt(0)),
+                 g.TempImmediate(mshift.Value() & 0x1f));
+}
+
+// Only splats, i.e. vectors with four identical lanes, are supported.
+void VisitSimd128Splat(InstructionSelector* selector, Node* node,
+                       ArchOpcode opcode) {
+  X64OperandGenerator g(selector);
+  Node* const value = node->InputAt(0);
+  for (int i = 1; i < node->InputCount(); ++i) {
+    CHECK_EQ(value, node->InputAt(i));
+  }
+  selector->Emit(opcode, g.DefineAsRegister(node), g.UseRegister(value));
+}
+
+}  // namespace
+
+void InstructionSelector::VisitCreateFloat32x4(Node* node) {
+  VisitSimd128Splat(this, node, kSSEFloat32x4Splat);
+}
+
+void InstructionSelector::VisitFloat32x4Add(Node* node) {
+  VisitSimd128Binop(this, node, kSSEFloat32x4Add);
+}
+
+void InstructionSelector::VisitFloat32x4Sub(Node* node) {
+  VisitSimd128Binop(this, node, kSSEFloat32x4Sub);
+}
+
+void InstructionSelector::VisitFloat32x4Mul(Node* node) {
+  VisitSimd128Binop(this, node, kSSEFloat32x4Mul);
+}
+
+void InstructionSelector::VisitFloat32x4Div(Node* node) {
+  VisitSimd128Binop(this, node, kSSEFloat32x4Div);
+}
+
+void InstructionSelector::VisitCreateInt32x4(Node* node) {
+  VisitSimd128Splat(this, node, kSSEInt32x4Splat);
+}
+
+void InstructionSelector::VisitInt32x4Add(Node* node) {
+  VisitSimd128Binop(this, node, kSSEInt32x4Add);
+}
+
+void InstructionSelector::VisitInt32x4Sub(Node* node) {
+  VisitSimd128Binop(this, node, kSSEInt32x4Sub);
+}
+
+void InstructionSelector::VisitInt32x4Mul(Node* node) {
+  DCHECK(CpuFeatures::IsSupported(SSE4_1));
+  VisitSimd128Binop(this, node, kSSEInt32x4Mul);
+}
+
+void InstructionSelector::VisitInt32x4ShiftLeftByScalar(Node* node) {
+  VisitSimd128Shift(this, node, kSSEInt32x4ShiftLeftByScalar);
+}
+
+void InstructionSelector::VisitInt32x4ShiftRightByScalar(Node* node) {
+  VisitSimd128Shift(this, node, kSSEInt32x4ShiftRightByScalar);
+}
+
+void InstructionSelector::VisitUint32x4ShiftRightByScalar(Node* node) {
+  VisitSimd128Shift(this, node, kSSEUint32x4ShiftRightByScalar);
+}
+
+void InstructionSelector::VisitSimd128And(Node* node) {
+  VisitSimd128Binop(this, node, kSSESimd128And);
+}
+
+void InstructionSelector::VisitSimd128Or(Node* node) {
+  VisitSimd128Binop(this, node, kSSESimd128Or);
+}
+
+void InstructionSelector::VisitSimd128Xor(Node* node) {
+  VisitSimd128Binop(this, node, kSSESimd128Xor);
+}
+
 void InstructionSelector::VisitAtomicLoad(Node* node) {
   LoadRepresentation load_rep = LoadRepresentationOf(node->op());
   DCHECK(load_rep.representation() == MachineRepresentation::kWord8 ||
@@ -2162,7 +2264,8 @@ MachineOperatorBuilder::Flags
 InstructionSelector::SupportedMachineOperatorFlags() {
   MachineOperatorBuilder::Flags flags =
       MachineOperatorBuilder::kWord32ShiftIsSafe |
-      MachineOperatorBuilder::kWord32Ctz | MachineOperatorBuilder::kWord64Ctz;
+      MachineOperatorBuilder::kWord32Ctz | MachineOperatorBuilder::kWord64Ctz |
+      MachineOperatorBuilder::kSimd128Ops;
   if (CpuFeatures::IsSupported(POPCNT)) {
     flags |= MachineOperatorBuilder::kWord32Popcnt |
              MachineOperatorBuilder::kWord64Popcnt;
@@ -2175,7 +2278,8 @@ InstructionSelector::SupportedMachineOperatorFlags() {
              MachineOperatorBuilder::kFloat32RoundTruncate |
              MachineOperatorBuilder::kFloat64RoundTruncate |
              MachineOperatorBuilder::kFloat32RoundTiesEven |
-             MachineOperatorBuilder::kFloat64RoundTiesEven;
+             MachineOperatorBuilder::kFloat64RoundTiesEven |
+             MachineOperatorBuilder::kInt32x4Mul;
   }
   return flags;
 }
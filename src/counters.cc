@@ -333,6 +333,35 @@ void RuntimeCallStats::Print(std::ostream& os) {
   entries.Print(os);
 }
 
+void RuntimeCallStats::CollectCounters(
+    std::vector<RuntimeCallCounter*>* counters) {
+#define COLLECT_COUNTER(counter) \
+  if (counter.count > 0) counters->push_back(&counter);
+
+#define COLLECT_MANUAL_COUNTER(name) COLLECT_COUNTER(this->name)
+  FOR_EACH_MANUAL_COUNTER(COLLECT_MANUAL_COUNTER)
+#undef COLLECT_MANUAL_COUNTER
+
+#define COLLECT_RUNTIME_COUNTER(name, nargs, ressize) \
+  COLLECT_COUNTER(this->Runtime_##name)
+  FOR_EACH_INTRINSIC(COLLECT_RUNTIME_COUNTER)
+#undef COLLECT_RUNTIME_COUNTER
+
+#define COLLECT_BUILTIN_COUNTER(name) COLLECT_COUNTER(this->Builtin_##name)
+  BUILTIN_LIST_C(COLLECT_BUILTIN_COUNTER)
+#undef COLLECT_BUILTIN_COUNTER
+
+#define COLLECT_API_COUNTER(name) COLLECT_COUNTER(this->API_##name)
+  FOR_EACH_API_COUNTER(COLLECT_API_COUNTER)
+#undef COLLECT_API_COUNTER
+
+#define COLLECT_HANDLER_COUNTER(name) COLLECT_COUNTER(this->Handler_##name)
+  FOR_EACH_HANDLER_COUNTER(COLLECT_HANDLER_COUNTER)
+#undef COLLECT_HANDLER_COUNTER
+
+#undef COLLECT_COUNTER
+}
+
 void RuntimeCallStats::Reset() {
   if (!FLAG_runtime_call_stats) return;
 #define RESET_COUNTER(name) this->name.Reset();
@@ -356,5 +385,29 @@ void RuntimeCallStats::Reset() {
 #undef RESET_COUNTER
 }
 
+// static
+const char* RuntimeEventCounters::CompilerTierToString(CompilerTier tier) {
+  switch (tier) {
+#define TIER_NAME(name) \
+  case k##name:         \
+    return #name;
+    FOR_EACH_COMPILER_TIER(TIER_NAME)
+#undef TIER_NAME
+    case kCompilerTierCount:
+      break;
+  }
+  UNREACHABLE();
+  return nullptr;
+}
+
+void RuntimeEventCounters::Reset() {
+  for (int i = 0; i < Code::NUMBER_OF_KINDS; i++) ic_misses_[i] = 0;
+  for (int i = 0; i < kDeoptimizeReasonCount; i++) deopts_[i] = 0;
+  for (int i = 0; i < kCompilerTierCount; i++) {
+    compiles_[i].count = 0;
+    compiles_[i].time = base::TimeDelta();
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -10,6 +10,7 @@
 #include "src/base/platform/elapsed-timer.h"
 #include "src/base/platform/time.h"
 #include "src/builtins/builtins.h"
+#include "src/deoptimize-reason.h"
 #include "src/globals.h"
 #include "src/objects.h"
 #include "src/runtime/runtime.h"
@@ -688,6 +689,7 @@ class RuntimeCallTimer {
   V(Object_DeleteProperty)                          \
   V(OptimizeCode)                                   \
   V(Parse)                                          \
+  V(ParseInternalize)                               \
   V(ParseLazy)                                      \
   V(PropertyCallback)                               \
   V(PrototypeMap_TransitionToAccessorProperty)      \
@@ -714,8 +716,10 @@ class RuntimeCallTimer {
   V(LoadIC_LoadApiGetterStub)                   \
   V(LoadIC_LoadCallback)                        \
   V(LoadIC_LoadConstant)                        \
+  V(LoadIC_LoadConstantDH)                      \
   V(LoadIC_LoadConstantStub)                    \
   V(LoadIC_LoadField)                           \
+  V(LoadIC_LoadFieldDH)                         \
   V(LoadIC_LoadFieldStub)                       \
   V(LoadIC_LoadGlobal)                          \
   V(LoadIC_LoadInterceptor)                     \
@@ -779,6 +783,9 @@ class RuntimeCallStats {
   void Reset();
   void Print(std::ostream& os);
 
+  // Appends all counters that have been hit at least once to |counters|.
+  void CollectCounters(std::vector<RuntimeCallCounter*>* counters);
+
   RuntimeCallStats() { Reset(); }
   RuntimeCallTimer* current_timer() { return current_timer_; }
 
@@ -825,6 +832,66 @@ class RuntimeCallTimerScope {
   RuntimeCallTimer timer_;
 };
 
+#define FOR_EACH_COMPILER_TIER(V) \
+  V(Ignition)                     \
+  V(FullCodegen)                  \
+  V(Crankshaft)                   \
+  V(TurboFan)
+
+// Counters for IC misses, deoptimizations and compilations. Unlike the
+// RuntimeCallStats these are always collected, as they only cost an increment
+// on paths that are slow anyway, so that embedders can poll them in production
+// through v8::Isolate::GetRuntimeStatistics.
+class RuntimeEventCounters {
+ public:
+  enum CompilerTier {
+#define TIER_ENUM(name) k##name,
+    FOR_EACH_COMPILER_TIER(TIER_ENUM)
+#undef TIER_ENUM
+        kCompilerTierCount
+  };
+
+  struct CompileCounter {
+    int64_t count;
+    base::TimeDelta time;
+  };
+
+  static const int kDeoptimizeReasonCount =
+#define COUNT_DEOPTIMIZE_REASON(Name, message) +1
+      0 DEOPTIMIZE_REASON_LIST(COUNT_DEOPTIMIZE_REASON);
+#undef COUNT_DEOPTIMIZE_REASON
+
+  RuntimeEventCounters() { Reset(); }
+
+  void RecordICMiss(Code::Kind kind) { ic_misses_[kind]++; }
+  void RecordDeopt(DeoptimizeReason reason) {
+    deopts_[static_cast<int>(reason)]++;
+  }
+  void RecordCompile(CompilerTier tier, base::TimeDelta time) {
+    compiles_[tier].count++;
+    compiles_[tier].time += time;
+  }
+
+  int64_t ic_misses(Code::Kind kind) const { return ic_misses_[kind]; }
+  int64_t deopts(DeoptimizeReason reason) const {
+    return deopts_[static_cast<int>(reason)];
+  }
+  const CompileCounter& compiles(CompilerTier tier) const {
+    return compiles_[tier];
+  }
+
+  static const char* CompilerTierToString(CompilerTier tier);
+
+  void Reset();
+
+ private:
+  int64_t ic_misses_[Code::NUMBER_OF_KINDS];
+  int64_t deopts_[kDeoptimizeReasonCount];
+  CompileCounter compiles_[kCompilerTierCount];
+
+  DISALLOW_COPY_AND_ASSIGN(RuntimeEventCounters);
+};
+
 #define HISTOGRAM_RANGE_LIST(HR)                                              \
   /* Generic range histograms */                                              \
   HR(detached_context_age_in_gc, V8.DetachedContextAgeInGC, 0, 20, 21)        \
@@ -898,7 +965,12 @@ class RuntimeCallTimerScope {
   HP(heap_fraction_old_space, V8.MemoryHeapFractionOldSpace)                   \
   HP(heap_fraction_code_space, V8.MemoryHeapFractionCodeSpace)                 \
   HP(heap_fraction_map_space, V8.MemoryHeapFractionMapSpace)                   \
-  HP(heap_fraction_lo_space, V8.MemoryHeapFractionLoSpace)
+  HP(heap_fraction_lo_space, V8.MemoryHeapFractionLoSpace)                     \
+  /* Percentages of megamorphic stub cache entries in use at full GCs. */      \
+  HP(load_stub_cache_primary_occupancy, V8.LoadStubCachePrimaryOccupancy)      \
+  HP(load_stub_cache_secondary_occupancy, V8.LoadStubCacheSecondaryOccupancy)  \
+  HP(store_stub_cache_primary_occupancy, V8.StoreStubCachePrimaryOccupancy)    \
+  HP(store_stub_cache_secondary_occupancy, V8.StoreStubCacheSecondaryOccupancy)
 
 #define HISTOGRAM_LEGACY_MEMORY_LIST(HM)                                      \
   HM(heap_sample_total_committed, V8.MemoryHeapSampleTotalCommitted)          \
@@ -1002,6 +1074,7 @@ class RuntimeCallTimerScope {
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)             \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_evictions, V8.MegamorphicStubCacheEvictions)       \
   SC(enum_cache_hits, V8.EnumCacheHits)                                        \
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                           \
@@ -1167,6 +1240,9 @@ class Counters {
   void ResetCounters();
   void ResetHistograms();
   RuntimeCallStats* runtime_call_stats() { return &runtime_call_stats_; }
+  RuntimeEventCounters* runtime_event_counters() {
+    return &runtime_event_counters_;
+  }
 
  private:
 #define HR(name, caption, min, max, num_buckets) Histogram name##_;
@@ -1229,6 +1305,7 @@ class Counters {
 #undef SC
 
   RuntimeCallStats runtime_call_stats_;
+  RuntimeEventCounters runtime_event_counters_;
 
   friend class Isolate;
 
@@ -8462,8 +8462,9 @@ bool HOptimizedGraphBuilder::TryInline(Handle<JSFunction> target,
   // After this point, we've made a decision to inline this function (so
   // TryInline should always return true).
 
-  // If target was lazily compiled, it's literals array may not yet be set up.
-  JSFunction::EnsureLiterals(target);
+  // If target was lazily compiled, it's literals array may not yet be set up,
+  // and an interpreted target may not have its feedback vector yet.
+  JSFunction::EnsureFeedbackVector(target);
 
   // Type-check the inlined function.
   DCHECK(target_shared->has_deoptimization_support());
@@ -526,6 +526,9 @@ Deoptimizer::Deoptimizer(Isolate* isolate, JSFunction* function,
 #endif  // DEBUG
   if (compiled_code_->kind() == Code::OPTIMIZED_FUNCTION) {
     PROFILE(isolate_, CodeDeoptEvent(compiled_code_, from_, fp_to_sp_delta_));
+    DeoptInfo info = GetDeoptInfo(compiled_code_, from_);
+    isolate->counters()->runtime_event_counters()->RecordDeopt(
+        info.deopt_reason);
   }
   unsigned size = ComputeInputFrameSize();
   int parameter_count =
@@ -307,6 +307,13 @@ DEFINE_BOOL(ignition_deadcode, true,
 DEFINE_BOOL(ignition_osr, false, "enable support for OSR from ignition code")
 DEFINE_BOOL(ignition_peephole, true, "use ignition peephole optimizer")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
+DEFINE_BOOL(ignition_short_bytecodes, false,
+            "use short-form Star and Ldar bytecodes with implicit registers")
+DEFINE_BOOL(lazy_feedback_allocation, false,
+            "allocate feedback vectors of interpreted functions lazily")
+DEFINE_INT(feedback_allocation_budget, 8,
+           "number of returns from an interpreted function before its "
+           "feedback vector is allocated")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
 DEFINE_BOOL(print_bytecode, false,
@@ -433,6 +440,9 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_INT(turbo_fast_register_allocation_threshold, 20000,
+           "number of instructions above which TurboFan skips the costly "
+           "register allocation heuristics")
 DEFINE_BOOL(turbo_loop_stackcheck, true, "enable stack checks in loops")
 DEFINE_STRING(turbo_filter, "~~", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
@@ -466,6 +476,8 @@ DEFINE_BOOL(native_context_specialization, true,
             "enable native context specialization in TurboFan")
 DEFINE_BOOL(turbo_inlining, true, "enable inlining in TurboFan")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_BOOL(turbo_polymorphic_inlining, false,
+            "inline polymorphic call sites in TurboFan")
 DEFINE_BOOL(turbo_load_elimination, true, "enable load elimination in TurboFan")
 DEFINE_BOOL(trace_turbo_load_elimination, false,
             "trace TurboFan load elimination")
@@ -479,6 +491,12 @@ DEFINE_BOOL(turbo_stress_loop_peeling, false,
             "stress loop peeling optimization")
 DEFINE_BOOL(turbo_loop_peeling, false, "Turbofan loop peeling")
 DEFINE_BOOL(turbo_loop_variable, false, "Turbofan loop variable optimization")
+DEFINE_BOOL(turbo_licm, false, "Turbofan loop invariant code motion")
+DEFINE_BOOL(turbo_bounds_check_elimination, false,
+            "Turbofan bounds check elimination")
+DEFINE_BOOL(turbo_loop_vectorization, false, "Turbofan loop vectorization")
+DEFINE_IMPLICATION(turbo_loop_vectorization, turbo_bounds_check_elimination)
+DEFINE_IMPLICATION(turbo_loop_vectorization, turbo_loop_variable)
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_frame_elision, true, "elide frames in TurboFan")
 DEFINE_BOOL(turbo_cache_shared_code, true, "cache context-independent code")
@@ -745,6 +763,9 @@ DEFINE_BOOL(track_gc_object_stats, false,
 DEFINE_BOOL(trace_gc_object_stats, false,
             "trace object counts and memory usage")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
+DEFINE_BOOL(trace_zone_stats, false, "trace zone memory usage")
+DEFINE_INT(zone_segment_pool_size, 2048,
+           "maximum size of the pool of recycled zone segments (in KB)")
 DEFINE_BOOL(track_detached_contexts, true,
             "track native contexts that are expected to be garbage collected")
 DEFINE_BOOL(trace_detached_contexts, false,
@@ -785,6 +806,8 @@ DEFINE_BOOL(use_idle_notification, true,
 DEFINE_BOOL(use_ic, true, "use inline caching")
 DEFINE_BOOL(trace_ic, false, "trace inline cache state transitions")
 DEFINE_BOOL(tf_load_ic_stub, true, "use TF LoadIC stub")
+DEFINE_INT(max_polymorphic_map_count, 4,
+           "maximum number of maps to track in POLYMORPHIC state")
 
 // macro-assembler-ia32.cc
 DEFINE_BOOL(native_code_counters, false,
@@ -1042,6 +1065,11 @@ DEFINE_BOOL(prof, false,
             "Log statistical profiling information (implies --log-code).")
 DEFINE_BOOL(prof_cpp, false, "Like --prof, but ignore generated code.")
 DEFINE_IMPLICATION(prof, prof_cpp)
+DEFINE_BOOL(prof_binary, false,
+            "Used with --prof, writes ticks and code events in a compact binary "
+            "format to <logfile>.bin instead of logging ticks as text "
+            "(see tools/binary-tickprocessor.cc).")
+DEFINE_IMPLICATION(prof_binary, prof)
 DEFINE_BOOL(prof_browser_mode, true,
             "Used with --prof, turns on browser-compatible mode for profiling.")
 DEFINE_BOOL(log_regexp, false, "Log regular expression execution.")
@@ -1051,16 +1079,20 @@ DEFINE_BOOL(ll_prof, false, "Enable low-level linux profiler.")
 DEFINE_BOOL(perf_basic_prof, false,
             "Enable perf linux profiler (basic support).")
 DEFINE_NEG_IMPLICATION(perf_basic_prof, compact_code_space)
+DEFINE_IMPLICATION(perf_basic_prof, interpreted_frames_native_stack)
 DEFINE_BOOL(perf_basic_prof_only_functions, false,
             "Only report function code ranges to perf (i.e. no stubs).")
 DEFINE_IMPLICATION(perf_basic_prof_only_functions, perf_basic_prof)
 DEFINE_BOOL(perf_prof, false,
             "Enable perf linux profiler (experimental annotate support).")
-DEFINE_NEG_IMPLICATION(perf_prof, compact_code_space)
+DEFINE_IMPLICATION(perf_prof, interpreted_frames_native_stack)
 DEFINE_BOOL(perf_prof_debug_info, false,
             "Enable debug info for perf linux profiler (experimental).")
 DEFINE_BOOL(perf_prof_unwinding_info, false,
             "Enable unwinding info for perf linux profiler (experimental).")
+DEFINE_BOOL(interpreted_frames_native_stack, false,
+            "Give each interpreted function its own copy of the interpreter "
+            "entry trampoline, so native profilers can attribute samples.")
 DEFINE_STRING(gc_fake_mmap, "/tmp/__v8_gc__",
               "Specify the name of the file for fake gc mmap used in ll_prof")
 DEFINE_BOOL(log_internal_timer_events, false, "Time internal events.")
@@ -13,6 +13,7 @@
 #include "src/deoptimizer.h"
 #include "src/frames-inl.h"
 #include "src/full-codegen/full-codegen.h"
+#include "src/interpreter/interpreter.h"
 #include "src/register-configuration.h"
 #include "src/safepoint-table.h"
 #include "src/string-stream.h"
@@ -416,7 +417,9 @@ static bool IsInterpreterFramePc(Isolate* isolate, Address pc) {
          (pc >= interpreter_bytecode_dispatch->instruction_start() &&
           pc < interpreter_bytecode_dispatch->instruction_end()) ||
          (pc >= interpreter_baseline_on_return->instruction_start() &&
-          pc < interpreter_baseline_on_return->instruction_end());
+          pc < interpreter_baseline_on_return->instruction_end()) ||
+         (FLAG_interpreted_frames_native_stack &&
+          isolate->interpreter()->IsTrampolineCopyPc(pc));
 }
 
 StackFrame::Type StackFrame::ComputeType(const StackFrameIteratorBase* iterator,
@@ -3039,6 +3039,7 @@ AllocationResult Heap::AllocateBytecodeArray(int length,
   instance->set_parameter_count(parameter_count);
   instance->set_interrupt_budget(interpreter::Interpreter::InterruptBudget());
   instance->set_osr_loop_nesting_level(0);
+  instance->set_feedback_allocation_budget(FLAG_feedback_allocation_budget);
   instance->set_constant_pool(constant_pool);
   instance->set_handler_table(empty_fixed_array());
   instance->set_source_position_table(empty_byte_array());
@@ -3405,6 +3406,8 @@ AllocationResult Heap::CopyBytecodeArray(BytecodeArray* bytecode_array) {
   copy->set_source_position_table(bytecode_array->source_position_table());
   copy->set_interrupt_budget(bytecode_array->interrupt_budget());
   copy->set_osr_loop_nesting_level(bytecode_array->osr_loop_nesting_level());
+  copy->set_feedback_allocation_budget(
+      bytecode_array->feedback_allocation_budget());
   bytecode_array->CopyBytecodesTo(copy);
   return copy;
 }
@@ -4435,6 +4438,12 @@ void Heap::CollectGarbageOnMemoryPressure(const char* source) {
 
 void Heap::MemoryPressureNotification(MemoryPressureLevel level,
                                       bool is_isolate_locked) {
+  // Pooled zone segments are not in use, so give them back right away.
+  if (level == MemoryPressureLevel::kCritical) {
+    isolate()->allocator()->ClearSegmentPool();
+  } else if (level == MemoryPressureLevel::kModerate) {
+    isolate()->allocator()->DecaySegmentPool();
+  }
   MemoryPressureLevel previous = memory_pressure_level_.Value();
   memory_pressure_level_.SetValue(level);
   if ((previous != MemoryPressureLevel::kCritical &&
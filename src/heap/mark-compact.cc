@@ -25,6 +25,7 @@
 #include "src/heap/spaces-inl.h"
 #include "src/ic/ic.h"
 #include "src/ic/stub-cache.h"
+#include "src/interpreter/interpreter.h"
 #include "src/utils-inl.h"
 #include "src/v8.h"
 
@@ -862,6 +863,8 @@ void MarkCompactCollector::Finish() {
   // their lazy re-initialization. This must be done after the
   // GC, because it relies on the new address of certain old space
   // objects (empty string, illegal builtin).
+  isolate()->load_stub_cache()->SampleOccupancy();
+  isolate()->store_stub_cache()->SampleOccupancy();
   isolate()->load_stub_cache()->Clear();
   isolate()->store_stub_cache()->Clear();
 
@@ -2421,6 +2424,10 @@ void MarkCompactCollector::ClearNonLiveReferences() {
     code_flusher_->ProcessCandidates();
   }
 
+  // Forget dead code that is recorded by address outside of the heap.
+  heap()->isolate()->interpreter()->ClearDeadTrampolineCopies();
+  heap()->isolate()->logger()->ClearDeadCodeEntries();
+
 
   DependentCode* dependent_code_list;
   Object* non_live_map_list;
@@ -3809,6 +3816,8 @@ void MarkCompactCollector::UpdatePointersAfterEvacuation() {
 
     EvacuationWeakObjectRetainer evacuation_object_retainer;
     heap()->ProcessWeakListRoots(&evacuation_object_retainer);
+
+    heap()->isolate()->interpreter()->UpdateTrampolineCopiesAfterEvacuation();
   }
 }
 
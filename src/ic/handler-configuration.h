@@ -0,0 +1,58 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_IC_HANDLER_CONFIGURATION_H_
+#define V8_IC_HANDLER_CONFIGURATION_H_
+
+#include "src/field-index.h"
+#include "src/globals.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+// A set of bit fields representing Smi handlers for loads. Smi handlers are
+// interpreted by the LoadIC/KeyedLoadIC stubs generated by the
+// CodeStubAssembler, so that the most common cases do not need a compiled
+// handler stub per property.
+class LoadHandler {
+ public:
+  enum Kind { kForConstants, kForFields };
+  class KindBits : public BitField<Kind, 0, 1> {};
+
+  //
+  // Encoding when KindBits contains kForFields: the layout produced by
+  // FieldIndex::GetLoadByFieldOffset(), whose property marker bit coincides
+  // with KindBits.
+  //
+  STATIC_ASSERT(kForFields == 1);
+  class IsInobjectBits : public FieldIndex::FieldOffsetIsInobject {};
+  class IsDoubleBits : public FieldIndex::FieldOffsetIsDouble {};
+  class FieldOffsetBits : public FieldIndex::FieldOffsetOffset {};
+
+  //
+  // Encoding when KindBits contains kForConstants: the descriptor of the
+  // constant in the receiver map's descriptor array.
+  //
+  class DescriptorBits
+      : public BitField<int, KindBits::kNext, kDescriptorIndexBitCount> {};
+  // Make sure we don't overflow into the sign bit.
+  STATIC_ASSERT(DescriptorBits::kNext <= kSmiValueSize - 1);
+
+  // Creates a Smi handler for loading a field from the receiver.
+  static inline int LoadField(FieldIndex field_index) {
+    return field_index.GetLoadByFieldOffset();
+  }
+
+  // Creates a Smi handler for loading a constant from the receiver map's
+  // descriptor array.
+  static inline int LoadConstant(int descriptor) {
+    return KindBits::encode(kForConstants) | DescriptorBits::encode(descriptor);
+  }
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_IC_HANDLER_CONFIGURATION_H_
@@ -16,6 +16,7 @@
 #include "src/frames-inl.h"
 #include "src/ic/call-optimization.h"
 #include "src/ic/handler-compiler.h"
+#include "src/ic/handler-configuration.h"
 #include "src/ic/ic-compiler.h"
 #include "src/ic/ic-inl.h"
 #include "src/ic/stub-cache.h"
@@ -85,6 +86,10 @@ const char* GetTransitionMarkModifier(KeyedAccessStoreMode mode) {
 #endif  // DEBUG
 
 
+void IC::RecordMiss() {
+  isolate()->counters()->runtime_event_counters()->RecordICMiss(kind());
+}
+
 void IC::TraceIC(const char* type, Handle<Object> name) {
   if (FLAG_trace_ic) {
     if (AddressIsDeoptimizedCode()) return;
@@ -311,6 +316,7 @@ bool IC::RecomputeHandlerForName(Handle<Object> name) {
 
 
 void IC::UpdateState(Handle<Object> receiver, Handle<Object> name) {
+  RecordMiss();
   update_receiver_map(receiver);
   if (!name->IsString()) return;
   if (state() != MONOMORPHIC && state() != POLYMORPHIC) return;
@@ -718,7 +724,7 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name, Handle<Object> code) {
   int number_of_valid_maps =
       number_of_maps - deprecated_maps - (handler_to_overwrite != -1);
 
-  if (number_of_valid_maps >= 4) return false;
+  if (number_of_valid_maps >= FLAG_max_polymorphic_map_count) return false;
   if (number_of_maps == 0 && state() != MONOMORPHIC && state() != POLYMORPHIC) {
     return false;
   }
@@ -827,7 +833,8 @@ Handle<Code> KeyedStoreIC::ChooseMegamorphicStub(Isolate* isolate,
 
 Handle<Object> LoadIC::SimpleFieldLoad(FieldIndex index) {
   if (FLAG_tf_load_ic_stub) {
-    return handle(Smi::FromInt(index.GetLoadByFieldOffset()), isolate());
+    TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldDH);
+    return handle(Smi::FromInt(LoadHandler::LoadField(index)), isolate());
   }
   TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldStub);
   LoadFieldStub stub(isolate(), index);
@@ -963,11 +970,19 @@ void IC::UpdateMegamorphicCache(Map* map, Name* name, Object* code) {
     // TODO(jkummerow): Support Smis in the code cache.
     Handle<Map> map_handle(map, isolate());
     Handle<Name> name_handle(name, isolate());
-    FieldIndex index =
-        FieldIndex::ForLoadByFieldOffset(map, Smi::cast(code)->value());
-    TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldStub);
-    LoadFieldStub stub(isolate(), index);
-    Code* handler = *stub.GetCode();
+    int config = Smi::cast(code)->value();
+    Code* handler;
+    if (LoadHandler::KindBits::decode(config) == LoadHandler::kForFields) {
+      FieldIndex index = FieldIndex::ForLoadByFieldOffset(map, config);
+      TRACE_HANDLER_STATS(isolate(), LoadIC_LoadFieldStub);
+      LoadFieldStub stub(isolate(), index);
+      handler = *stub.GetCode();
+    } else {
+      int descriptor = LoadHandler::DescriptorBits::decode(config);
+      TRACE_HANDLER_STATS(isolate(), LoadIC_LoadConstantStub);
+      LoadConstantStub stub(isolate(), descriptor);
+      handler = *stub.GetCode();
+    }
     stub_cache()->Set(*name_handle, *map_handle, handler);
     return;
   }
@@ -1156,6 +1171,11 @@ Handle<Object> LoadIC::GetMapIndependentHandler(LookupIterator* lookup) {
       // -------------- Constant properties --------------
       DCHECK(lookup->property_details().type() == DATA_CONSTANT);
       if (receiver_is_holder) {
+        if (FLAG_tf_load_ic_stub) {
+          TRACE_HANDLER_STATS(isolate(), LoadIC_LoadConstantDH);
+          int config = LoadHandler::LoadConstant(lookup->GetConstantIndex());
+          return handle(Smi::FromInt(config), isolate());
+        }
         TRACE_HANDLER_STATS(isolate(), LoadIC_LoadConstantStub);
         LoadConstantStub stub(isolate(), lookup->GetConstantIndex());
         return stub.GetCode();
@@ -1375,7 +1395,7 @@ void KeyedLoadIC::UpdateLoadElement(Handle<HeapObject> receiver) {
 
   // If the maximum number of receiver maps has been exceeded, use the generic
   // version of the IC.
-  if (target_receiver_maps.length() > kMaxKeyedPolymorphism) {
+  if (target_receiver_maps.length() > FLAG_max_polymorphic_map_count) {
     TRACE_GENERIC_IC(isolate(), "KeyedLoadIC", "max polymorph exceeded");
     return;
   }
@@ -1942,7 +1962,7 @@ void KeyedStoreIC::UpdateStoreElement(Handle<Map> receiver_map,
 
   // If the maximum number of receiver maps has been exceeded, use the
   // megamorphic version of the IC.
-  if (target_receiver_maps.length() > kMaxKeyedPolymorphism) return;
+  if (target_receiver_maps.length() > FLAG_max_polymorphic_map_count) return;
 
   // Make sure all polymorphic handlers have the same store mode, otherwise the
   // megamorphic stub must be used.
@@ -2184,6 +2204,7 @@ MaybeHandle<Object> KeyedStoreIC::Store(Handle<Object> object,
 
 
 void CallIC::HandleMiss(Handle<Object> function) {
+  RecordMiss();
   Handle<Object> name = isolate()->factory()->empty_string();
   CallICNexus* nexus = casted_nexus<CallICNexus>();
   Object* feedback = nexus->GetFeedback();
@@ -2537,6 +2558,7 @@ RUNTIME_FUNCTION(Runtime_ElementsTransitionAndStoreIC_Miss) {
 MaybeHandle<Object> BinaryOpIC::Transition(
     Handle<AllocationSite> allocation_site, Handle<Object> left,
     Handle<Object> right) {
+  RecordMiss();
   BinaryOpICState state(isolate(), extra_ic_state());
 
   // Compute the actual result using the builtin for the binary operation.
@@ -2690,6 +2712,7 @@ Code* CompareIC::GetRawUninitialized(Isolate* isolate, Token::Value op) {
 }
 
 Code* CompareIC::UpdateCaches(Handle<Object> x, Handle<Object> y) {
+  RecordMiss();
   HandleScope scope(isolate());
   CompareICStub old_stub(target()->stub_key(), isolate());
   CompareICState::State new_left =
@@ -2748,6 +2771,7 @@ RUNTIME_FUNCTION(Runtime_Unreachable) {
 
 
 Handle<Object> ToBooleanIC::ToBoolean(Handle<Object> object) {
+  RecordMiss();
   ToBooleanICStub stub(isolate(), extra_ic_state());
   bool to_boolean_value = stub.UpdateStatus(object);
   Handle<Code> code = stub.GetCode();
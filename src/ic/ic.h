@@ -118,6 +118,8 @@ class IC {
                             CodeHandleList* handlers);
 
   char TransitionMarkFromState(IC::State state);
+  // Counts a miss of this IC in the isolate's RuntimeEventCounters.
+  void RecordMiss();
   void TraceIC(const char* type, Handle<Object> name);
   void TraceIC(const char* type, Handle<Object> name, State old_state,
                State new_state);
@@ -57,6 +57,9 @@ Code* StubCache::Set(Name* name, Map* map, Code* code) {
     int seed = PrimaryOffset(primary->key, old_map);
     int secondary_offset = SecondaryOffset(primary->key, seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (secondary->map != NULL) {
+      isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -99,6 +102,36 @@ void StubCache::Clear() {
 }
 
 
+void StubCache::SampleOccupancy() {
+  Counters* counters = isolate()->counters();
+  Histogram* primary_histogram;
+  Histogram* secondary_histogram;
+  if (ic_kind() == Code::LOAD_IC) {
+    primary_histogram = counters->load_stub_cache_primary_occupancy();
+    secondary_histogram = counters->load_stub_cache_secondary_occupancy();
+  } else {
+    DCHECK_EQ(Code::STORE_IC, ic_kind());
+    primary_histogram = counters->store_stub_cache_primary_occupancy();
+    secondary_histogram = counters->store_stub_cache_secondary_occupancy();
+  }
+  if (!primary_histogram->Enabled() && !secondary_histogram->Enabled()) {
+    return;
+  }
+  // The entries are not updated by the GC, so only the map field, which is
+  // NULL for empty entries, can be relied upon here.
+  int primary_used = 0;
+  for (int i = 0; i < kPrimaryTableSize; i++) {
+    if (primary_[i].map != NULL) primary_used++;
+  }
+  int secondary_used = 0;
+  for (int j = 0; j < kSecondaryTableSize; j++) {
+    if (secondary_[j].map != NULL) secondary_used++;
+  }
+  primary_histogram->AddSample(primary_used * 100 / kPrimaryTableSize);
+  secondary_histogram->AddSample(secondary_used * 100 / kSecondaryTableSize);
+}
+
+
 void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
                                     Handle<Context> native_context,
                                     Zone* zone) {
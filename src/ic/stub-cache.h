@@ -44,6 +44,9 @@ class StubCache {
   Code* Get(Name* name, Map* map);
   // Clear the lookup table (@ mark compact collection).
   void Clear();
+  // Sample the fraction of entries in use into the occupancy histograms
+  // (@ mark compact collection, before the table is cleared).
+  void SampleOccupancy();
   // Collect all maps that match the name.
   void CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
                            Handle<Context> native_context, Zone* zone);
@@ -45,7 +45,7 @@ bool BytecodeArrayIterator::done() const {
   return bytecode_offset_ >= bytecode_array()->length();
 }
 
-Bytecode BytecodeArrayIterator::current_bytecode() const {
+Bytecode BytecodeArrayIterator::current_raw_bytecode() const {
   DCHECK(!done());
   uint8_t current_byte =
       bytecode_array()->get(bytecode_offset_ + current_prefix_offset());
@@ -54,9 +54,17 @@ Bytecode BytecodeArrayIterator::current_bytecode() const {
   return current_bytecode;
 }
 
+Bytecode BytecodeArrayIterator::current_bytecode() const {
+  Bytecode current_bytecode = current_raw_bytecode();
+  if (Bytecodes::IsShortForm(current_bytecode)) {
+    return Bytecodes::GetLongForm(current_bytecode);
+  }
+  return current_bytecode;
+}
+
 int BytecodeArrayIterator::current_bytecode_size() const {
   return current_prefix_offset() +
-         Bytecodes::Size(current_bytecode(), current_operand_scale());
+         Bytecodes::Size(current_raw_bytecode(), current_operand_scale());
 }
 
 uint32_t BytecodeArrayIterator::GetUnsignedOperand(
@@ -118,6 +126,11 @@ uint32_t BytecodeArrayIterator::GetIndexOperand(int operand_index) const {
 }
 
 Register BytecodeArrayIterator::GetRegisterOperand(int operand_index) const {
+  Bytecode raw_bytecode = current_raw_bytecode();
+  if (Bytecodes::IsShortForm(raw_bytecode)) {
+    DCHECK_EQ(0, operand_index);
+    return Register(Bytecodes::GetShortFormRegisterIndex(raw_bytecode));
+  }
   OperandType operand_type =
       Bytecodes::GetOperandType(current_bytecode(), operand_index);
   const uint8_t* operand_start =
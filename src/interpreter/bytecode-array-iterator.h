@@ -21,7 +21,12 @@ class BytecodeArrayIterator {
 
   void Advance();
   bool done() const;
+  // Returns the current bytecode. Short-form bytecodes with an implicit
+  // register operand are returned as their long form, e.g. Star0 is returned
+  // as Star with register operand r0.
   Bytecode current_bytecode() const;
+  // Returns the bytecode as encoded in the bytecode array.
+  Bytecode current_raw_bytecode() const;
   int current_bytecode_size() const;
   int current_offset() const { return bytecode_offset_; }
   OperandScale current_operand_scale() const { return operand_scale_; }
@@ -163,6 +163,8 @@ OperandScale GetOperandScale(const BytecodeNode* const node) {
 void BytecodeArrayWriter::EmitBytecode(const BytecodeNode* const node) {
   DCHECK_NE(node->bytecode(), Bytecode::kIllegal);
 
+  if (FLAG_ignition_short_bytecodes && EmitShortFormBytecode(node)) return;
+
   uint8_t buffer[kMaxSizeOfPackedBytecode];
   uint8_t* buffer_limit = buffer;
 
@@ -217,6 +219,19 @@ void BytecodeArrayWriter::EmitBytecode(const BytecodeNode* const node) {
   bytecodes()->insert(bytecodes()->end(), buffer, buffer_limit);
 }
 
+bool BytecodeArrayWriter::EmitShortFormBytecode(const BytecodeNode* const node) {
+  Bytecode bytecode = node->bytecode();
+  if (bytecode != Bytecode::kStar && bytecode != Bytecode::kLdar) return false;
+
+  Register reg = Register::FromOperand(static_cast<int32_t>(node->operand(0)));
+  if (!Bytecodes::HasShortForm(bytecode, reg.index())) return false;
+
+  Bytecode short_form = Bytecodes::GetShortForm(bytecode, reg.index());
+  bytecodes()->push_back(Bytecodes::ToByte(short_form));
+  max_register_count_ = std::max(max_register_count_, reg.index() + 1);
+  return true;
+}
+
 // static
 Bytecode GetJumpWithConstantOperand(Bytecode jump_bytecode) {
   switch (jump_bytecode) {
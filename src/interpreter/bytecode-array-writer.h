@@ -60,6 +60,7 @@ class BytecodeArrayWriter final : public BytecodePipelineStage {
   void PatchJumpWith32BitOperand(size_t jump_location, int delta);
 
   void EmitBytecode(const BytecodeNode* const node);
+  bool EmitShortFormBytecode(const BytecodeNode* const node);
   void EmitJump(BytecodeNode* node, BytecodeLabel* label);
   void UpdateSourcePositionTable(const BytecodeNode* const node);
 
@@ -598,6 +598,74 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
   return false;
 }
 
+// static
+bool Bytecodes::IsConditionalJumpLookahead(Bytecode bytecode,
+                                           OperandScale operand_scale) {
+  if (operand_scale == OperandScale::kSingle) {
+    switch (bytecode) {
+      case Bytecode::kTestEqual:
+      case Bytecode::kTestNotEqual:
+      case Bytecode::kTestEqualStrict:
+      case Bytecode::kTestLessThan:
+      case Bytecode::kTestGreaterThan:
+      case Bytecode::kTestLessThanOrEqual:
+      case Bytecode::kTestGreaterThanOrEqual:
+        return true;
+      default:
+        return false;
+    }
+  }
+  return false;
+}
+
+// static
+bool Bytecodes::IsShortStar(Bytecode bytecode) {
+  STATIC_ASSERT(static_cast<int>(Bytecode::kStar15) -
+                    static_cast<int>(Bytecode::kStar0) + 1 ==
+                kShortFormRegisterCount);
+  return bytecode >= Bytecode::kStar0 && bytecode <= Bytecode::kStar15;
+}
+
+// static
+bool Bytecodes::IsShortLdar(Bytecode bytecode) {
+  STATIC_ASSERT(static_cast<int>(Bytecode::kLdar15) -
+                    static_cast<int>(Bytecode::kLdar0) + 1 ==
+                kShortFormRegisterCount);
+  return bytecode >= Bytecode::kLdar0 && bytecode <= Bytecode::kLdar15;
+}
+
+// static
+bool Bytecodes::IsShortForm(Bytecode bytecode) {
+  return IsShortStar(bytecode) || IsShortLdar(bytecode);
+}
+
+// static
+bool Bytecodes::HasShortForm(Bytecode bytecode, int register_index) {
+  return (bytecode == Bytecode::kStar || bytecode == Bytecode::kLdar) &&
+         register_index >= 0 && register_index < kShortFormRegisterCount;
+}
+
+// static
+Bytecode Bytecodes::GetShortForm(Bytecode bytecode, int register_index) {
+  DCHECK(HasShortForm(bytecode, register_index));
+  Bytecode base =
+      bytecode == Bytecode::kStar ? Bytecode::kStar0 : Bytecode::kLdar0;
+  return FromByte(ToByte(base) + register_index);
+}
+
+// static
+Bytecode Bytecodes::GetLongForm(Bytecode bytecode) {
+  DCHECK(IsShortForm(bytecode));
+  return IsShortStar(bytecode) ? Bytecode::kStar : Bytecode::kLdar;
+}
+
+// static
+int Bytecodes::GetShortFormRegisterIndex(Bytecode bytecode) {
+  DCHECK(IsShortForm(bytecode));
+  Bytecode base = IsShortStar(bytecode) ? Bytecode::kStar0 : Bytecode::kLdar0;
+  return ToByte(bytecode) - ToByte(base);
+}
+
 // static
 int Bytecodes::GetNumberOfRegistersRepresentedBy(OperandType operand_type) {
   switch (operand_type) {
@@ -74,6 +74,50 @@ namespace interpreter {
   DEBUG_BREAK_PLAIN_BYTECODE_LIST(V) \
   DEBUG_BREAK_PREFIX_BYTECODE_LIST(V)
 
+// Define short-form register-accumulator transfers which encode registers
+// r0..r15 in the bytecode itself rather than in a register operand. These are
+// only emitted by the BytecodeArrayWriter when --ignition-short-bytecodes is
+// enabled. Format is V(<bytecode>, <accumulator_use>).
+#define SHORT_STAR_BYTECODE_LIST(V) \
+  V(Star0, AccumulatorUse::kRead)   \
+  V(Star1, AccumulatorUse::kRead)   \
+  V(Star2, AccumulatorUse::kRead)   \
+  V(Star3, AccumulatorUse::kRead)   \
+  V(Star4, AccumulatorUse::kRead)   \
+  V(Star5, AccumulatorUse::kRead)   \
+  V(Star6, AccumulatorUse::kRead)   \
+  V(Star7, AccumulatorUse::kRead)   \
+  V(Star8, AccumulatorUse::kRead)   \
+  V(Star9, AccumulatorUse::kRead)   \
+  V(Star10, AccumulatorUse::kRead)  \
+  V(Star11, AccumulatorUse::kRead)  \
+  V(Star12, AccumulatorUse::kRead)  \
+  V(Star13, AccumulatorUse::kRead)  \
+  V(Star14, AccumulatorUse::kRead)  \
+  V(Star15, AccumulatorUse::kRead)
+
+#define SHORT_LDAR_BYTECODE_LIST(V) \
+  V(Ldar0, AccumulatorUse::kWrite)  \
+  V(Ldar1, AccumulatorUse::kWrite)  \
+  V(Ldar2, AccumulatorUse::kWrite)  \
+  V(Ldar3, AccumulatorUse::kWrite)  \
+  V(Ldar4, AccumulatorUse::kWrite)  \
+  V(Ldar5, AccumulatorUse::kWrite)  \
+  V(Ldar6, AccumulatorUse::kWrite)  \
+  V(Ldar7, AccumulatorUse::kWrite)  \
+  V(Ldar8, AccumulatorUse::kWrite)  \
+  V(Ldar9, AccumulatorUse::kWrite)  \
+  V(Ldar10, AccumulatorUse::kWrite) \
+  V(Ldar11, AccumulatorUse::kWrite) \
+  V(Ldar12, AccumulatorUse::kWrite) \
+  V(Ldar13, AccumulatorUse::kWrite) \
+  V(Ldar14, AccumulatorUse::kWrite) \
+  V(Ldar15, AccumulatorUse::kWrite)
+
+#define SHORT_FORM_BYTECODE_LIST(V) \
+  SHORT_STAR_BYTECODE_LIST(V)       \
+  SHORT_LDAR_BYTECODE_LIST(V)
+
 // The list of bytecodes which are interpreted by the interpreter.
 #define BYTECODE_LIST(V)                                                       \
   /* Extended width operands */                                                \
@@ -122,6 +166,9 @@ namespace interpreter {
   V(Ldar, AccumulatorUse::kWrite, OperandType::kReg)                           \
   V(Star, AccumulatorUse::kRead, OperandType::kRegOut)                         \
                                                                                \
+  /* Short-form register-accumulator transfers */                              \
+  SHORT_FORM_BYTECODE_LIST(V)                                                  \
+                                                                               \
   /* Register-register transfers */                                            \
   V(Mov, AccumulatorUse::kNone, OperandType::kReg, OperandType::kRegOut)       \
                                                                                \
@@ -369,6 +416,9 @@ class Bytecodes final {
   //  The maximum number of operands a bytecode may have.
   static const int kMaxOperands = 4;
 
+  // The number of registers with short-form Star and Ldar bytecodes.
+  static const int kShortFormRegisterCount = 16;
+
   // Returns string representation of |bytecode|.
   static const char* ToString(Bytecode bytecode);
 
@@ -539,6 +589,33 @@ class Bytecodes final {
   // dispatch to a Star bytecode.
   static bool IsStarLookahead(Bytecode bytecode, OperandScale operand_scale);
 
+  // Returns true if the handler for |bytecode| should look ahead and inline a
+  // dispatch to a JumpIfTrue or JumpIfFalse bytecode.
+  static bool IsConditionalJumpLookahead(Bytecode bytecode,
+                                         OperandScale operand_scale);
+
+  // Returns true if |bytecode| is a short-form Star with an implicit register.
+  static bool IsShortStar(Bytecode bytecode);
+
+  // Returns true if |bytecode| is a short-form Ldar with an implicit register.
+  static bool IsShortLdar(Bytecode bytecode);
+
+  // Returns true if |bytecode| encodes its register operand in the bytecode.
+  static bool IsShortForm(Bytecode bytecode);
+
+  // Returns true if |bytecode| with register operand |register_index| has a
+  // short-form encoding.
+  static bool HasShortForm(Bytecode bytecode, int register_index);
+
+  // Returns the short form of |bytecode| for register |register_index|.
+  static Bytecode GetShortForm(Bytecode bytecode, int register_index);
+
+  // Returns the bytecode that the short-form |bytecode| abbreviates.
+  static Bytecode GetLongForm(Bytecode bytecode);
+
+  // Returns the index of the register implied by the short-form |bytecode|.
+  static int GetShortFormRegisterIndex(Bytecode bytecode);
+
   // Returns the number of registers represented by a register operand. For
   // instance, a RegPair represents two registers.
   static int GetNumberOfRegistersRepresentedBy(OperandType operand_type);
@@ -420,6 +420,25 @@ Node* InterpreterAssembler::LoadTypeFeedbackVector() {
   return vector;
 }
 
+Node* InterpreterAssembler::IsFeedbackVectorPending(
+    Node* type_feedback_vector) {
+  return WordEqual(type_feedback_vector,
+                   LoadRoot(Heap::kEmptyFixedArrayRootIndex));
+}
+
+void InterpreterAssembler::UseDummyFeedbackIfPending(
+    int dummy_slot, Node** type_feedback_vector, Node** smi_slot) {
+  Handle<TypeFeedbackVector> dummy_vector =
+      TypeFeedbackVector::DummyVector(isolate());
+  int dummy_index =
+      TypeFeedbackVector::GetIndex(FeedbackVectorSlot(dummy_slot));
+  Node* is_pending = IsFeedbackVectorPending(*type_feedback_vector);
+  *type_feedback_vector =
+      Select(is_pending, HeapConstant(dummy_vector), *type_feedback_vector);
+  *smi_slot =
+      Select(is_pending, SmiConstant(Smi::FromInt(dummy_index)), *smi_slot);
+}
+
 void InterpreterAssembler::CallPrologue() {
   StoreRegister(SmiTag(BytecodeOffset()), Register::bytecode_offset());
 
@@ -469,6 +488,9 @@ Node* InterpreterAssembler::CallJSWithFeedback(Node* function, Node* context,
   Node* is_feedback_unavailable = Word32Equal(slot_id, Int32Constant(0));
   GotoIf(is_feedback_unavailable, &call);
 
+  // Neither is it while the feedback vector is pending.
+  GotoIf(IsFeedbackVectorPending(type_feedback_vector), &call);
+
   // The checks. First, does rdi match the recorded monomorphic target?
   Node* feedback_element = LoadFixedArrayElement(type_feedback_vector, slot_id);
   Node* feedback_value = LoadWeakCellValue(feedback_element);
@@ -680,6 +702,7 @@ Node* InterpreterAssembler::Advance(Node* delta) {
 
 Node* InterpreterAssembler::Jump(Node* delta) {
   DCHECK(!Bytecodes::IsStarLookahead(bytecode_, operand_scale_));
+  DCHECK(!Bytecodes::IsConditionalJumpLookahead(bytecode_, operand_scale_));
 
   UpdateInterruptBudget(delta);
   Node* new_bytecode_offset = Advance(delta);
@@ -716,14 +739,24 @@ Node* InterpreterAssembler::LoadBytecode(compiler::Node* bytecode_offset) {
 }
 
 Node* InterpreterAssembler::StarDispatchLookahead(Node* target_bytecode) {
-  Label do_inline_star(this), done(this);
+  Label do_inline_star(this), do_inline_short_star(this), done(this);
 
   Variable var_bytecode(this, MachineRepresentation::kWord8);
   var_bytecode.Bind(target_bytecode);
 
   Node* star_bytecode = IntPtrConstant(static_cast<int>(Bytecode::kStar));
   Node* is_star = WordEqual(target_bytecode, star_bytecode);
-  BranchIf(is_star, &do_inline_star, &done);
+  Node* short_star_index = nullptr;
+  if (FLAG_ignition_short_bytecodes) {
+    GotoIf(is_star, &do_inline_star);
+    short_star_index = IntPtrSub(
+        target_bytecode, IntPtrConstant(static_cast<int>(Bytecode::kStar0)));
+    Node* is_short_star = UintPtrLessThan(
+        short_star_index, IntPtrConstant(Bytecodes::kShortFormRegisterCount));
+    BranchIf(is_short_star, &do_inline_short_star, &done);
+  } else {
+    BranchIf(is_star, &do_inline_star, &done);
+  }
 
   Bind(&do_inline_star);
   {
@@ -731,6 +764,14 @@ Node* InterpreterAssembler::StarDispatchLookahead(Node* target_bytecode) {
     var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
     Goto(&done);
   }
+  if (FLAG_ignition_short_bytecodes) {
+    Bind(&do_inline_short_star);
+    {
+      InlineShortStar(short_star_index);
+      var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+      Goto(&done);
+    }
+  }
   Bind(&done);
   return var_bytecode.value();
 }
@@ -754,12 +795,108 @@ void InterpreterAssembler::InlineStar() {
   accumulator_use_ = previous_acc_use;
 }
 
+void InterpreterAssembler::InlineShortStar(Node* register_index) {
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  // All short-form Star bytecodes share a size and accumulator use, so Star0
+  // stands in for the one at the current offset.
+  bytecode_ = Bytecode::kStar0;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+  if (FLAG_trace_ignition) {
+    TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+  }
+  Node* reg_operand =
+      IntPtrSub(IntPtrConstant(Register(0).ToOperand()), register_index);
+  StoreRegister(GetAccumulator(), reg_operand);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+
+  Advance();
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
+Node* InterpreterAssembler::ConditionalJumpDispatchLookahead(
+    Node* target_bytecode) {
+  Label do_inline_jump_if_true(this), do_inline_jump_if_false(this),
+      done(this);
+
+  Variable var_bytecode(this, MachineRepresentation::kWord8);
+  var_bytecode.Bind(target_bytecode);
+
+  Node* jump_if_true_bytecode =
+      IntPtrConstant(static_cast<int>(Bytecode::kJumpIfTrue));
+  Node* jump_if_false_bytecode =
+      IntPtrConstant(static_cast<int>(Bytecode::kJumpIfFalse));
+  GotoIf(WordEqual(target_bytecode, jump_if_true_bytecode),
+         &do_inline_jump_if_true);
+  Branch(WordEqual(target_bytecode, jump_if_false_bytecode),
+         &do_inline_jump_if_false, &done);
+
+  Bind(&do_inline_jump_if_true);
+  {
+    InlineConditionalJump(Bytecode::kJumpIfTrue);
+    var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+    Goto(&done);
+  }
+  Bind(&do_inline_jump_if_false);
+  {
+    InlineConditionalJump(Bytecode::kJumpIfFalse);
+    var_bytecode.Bind(LoadBytecode(BytecodeOffset()));
+    Goto(&done);
+  }
+  Bind(&done);
+  return var_bytecode.value();
+}
+
+void InterpreterAssembler::InlineConditionalJump(Bytecode jump_bytecode) {
+  DCHECK(jump_bytecode == Bytecode::kJumpIfTrue ||
+         jump_bytecode == Bytecode::kJumpIfFalse);
+  Bytecode previous_bytecode = bytecode_;
+  AccumulatorUse previous_acc_use = accumulator_use_;
+
+  bytecode_ = jump_bytecode;
+  accumulator_use_ = AccumulatorUse::kNone;
+
+  if (FLAG_trace_ignition) {
+    TraceBytecode(Runtime::kInterpreterTraceBytecodeEntry);
+  }
+  Node* accumulator = GetAccumulator();
+  Node* expected = BooleanConstant(jump_bytecode == Bytecode::kJumpIfTrue);
+
+  Label taken(this), not_taken(this), done(this);
+  BranchIfWordEqual(accumulator, expected, &taken, &not_taken);
+  Bind(&taken);
+  {
+    Node* delta = BytecodeOperandImm(0);
+    UpdateInterruptBudget(delta);
+    Advance(delta);
+    Goto(&done);
+  }
+  Bind(&not_taken);
+  {
+    Advance();
+    Goto(&done);
+  }
+  Bind(&done);
+
+  DCHECK_EQ(accumulator_use_, Bytecodes::GetAccumulatorUse(bytecode_));
+
+  bytecode_ = previous_bytecode;
+  accumulator_use_ = previous_acc_use;
+}
+
 Node* InterpreterAssembler::Dispatch() {
   Node* target_offset = Advance();
   Node* target_bytecode = LoadBytecode(target_offset);
 
   if (Bytecodes::IsStarLookahead(bytecode_, operand_scale_)) {
     target_bytecode = StarDispatchLookahead(target_bytecode);
+  } else if (Bytecodes::IsConditionalJumpLookahead(bytecode_,
+                                                   operand_scale_)) {
+    target_bytecode = ConditionalJumpDispatchLookahead(target_bytecode);
   }
   return DispatchToBytecode(target_bytecode, BytecodeOffset());
 }
@@ -839,6 +976,43 @@ void InterpreterAssembler::UpdateInterruptBudgetOnReturn() {
   UpdateInterruptBudget(profiling_weight);
 }
 
+void InterpreterAssembler::UpdateFeedbackAllocationBudgetOnReturn() {
+  Label check_metadata(this), update_budget(this),
+      allocate(this, Label::kDeferred), end(this);
+
+  Node* type_feedback_vector = LoadTypeFeedbackVector();
+  Branch(IsFeedbackVectorPending(type_feedback_vector), &check_metadata, &end);
+
+  // Functions without feedback slots have nothing to allocate.
+  Bind(&check_metadata);
+  Node* function = LoadRegister(Register::function_closure());
+  Node* shared_info =
+      LoadObjectField(function, JSFunction::kSharedFunctionInfoOffset);
+  Node* metadata = LoadObjectField(
+      shared_info, SharedFunctionInfo::kFeedbackMetadataOffset);
+  Branch(WordEqual(metadata, LoadRoot(Heap::kEmptyFixedArrayRootIndex)), &end,
+         &update_budget);
+
+  Bind(&update_budget);
+  Node* budget_offset = IntPtrConstant(
+      BytecodeArray::kFeedbackAllocationBudgetOffset - kHeapObjectTag);
+  Node* old_budget =
+      Load(MachineType::Int32(), BytecodeArrayTaggedPointer(), budget_offset);
+  Node* new_budget = Int32Sub(old_budget, Int32Constant(1));
+  StoreNoWriteBarrier(MachineRepresentation::kWord32,
+                      BytecodeArrayTaggedPointer(), budget_offset, new_budget);
+  Branch(Int32LessThanOrEqual(new_budget, Int32Constant(0)), &allocate, &end);
+
+  Bind(&allocate);
+  {
+    CallRuntime(Runtime::kInterpreterAllocateFeedbackVector, GetContext(),
+                function);
+    Goto(&end);
+  }
+
+  Bind(&end);
+}
+
 Node* InterpreterAssembler::StackCheckTriggeredInterrupt() {
   Node* sp = LoadStackPointer();
   Node* stack_limit = Load(
@@ -89,6 +89,18 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Load the TypeFeedbackVector for the current function.
   compiler::Node* LoadTypeFeedbackVector();
 
+  // Returns true if |type_feedback_vector| is the empty placeholder of a
+  // function whose vector has not been allocated yet.
+  compiler::Node* IsFeedbackVectorPending(
+      compiler::Node* type_feedback_vector);
+
+  // Replaces |*type_feedback_vector| and |*smi_slot| with the megamorphic
+  // |dummy_slot| of the dummy vector if the feedback vector is pending, so
+  // that the IC goes straight to the stub cache without recording feedback.
+  void UseDummyFeedbackIfPending(int dummy_slot,
+                                 compiler::Node** type_feedback_vector,
+                                 compiler::Node** smi_slot);
+
   // Call JSFunction or Callable |function| with |arg_count|
   // arguments (not including receiver) and the first argument
   // located at |first_arg|. Type feedback is collected in the
@@ -145,6 +157,10 @@ class InterpreterAssembler : public CodeStubAssembler {
   // Updates the profiler interrupt budget for a return.
   void UpdateInterruptBudgetOnReturn();
 
+  // Charges a return against the feedback allocation budget while the
+  // feedback vector is pending and allocates the vector once it is used up.
+  void UpdateFeedbackAllocationBudgetOnReturn();
+
   // Returns the OSR nesting level from the bytecode header.
   compiler::Node* LoadOSRNestingLevel();
 
@@ -253,6 +269,19 @@ class InterpreterAssembler : public CodeStubAssembler {
   // next dispatch offset.
   void InlineStar();
 
+  // Build code for the short-form Star storing to register |register_index|
+  // at the current BytecodeOffset() and Advance() to the next dispatch offset.
+  void InlineShortStar(compiler::Node* register_index);
+
+  // Look ahead for JumpIfTrue or JumpIfFalse and inline it in a branch.
+  // Returns a new target bytecode node for dispatch.
+  compiler::Node* ConditionalJumpDispatchLookahead(
+      compiler::Node* target_bytecode);
+
+  // Build code for the conditional |jump_bytecode| at the current
+  // BytecodeOffset() and Advance() to the next dispatch offset.
+  void InlineConditionalJump(Bytecode jump_bytecode);
+
   // Dispatch to |target_bytecode| at |new_bytecode_offset|.
   // |target_bytecode| should be equivalent to loading from the offset.
   compiler::Node* DispatchToBytecode(compiler::Node* target_bytecode,
@@ -4,6 +4,7 @@
 
 #include "src/interpreter/interpreter.h"
 
+#include <algorithm>
 #include <fstream>
 #include <memory>
 
@@ -11,6 +12,8 @@
 #include "src/code-factory.h"
 #include "src/compiler.h"
 #include "src/factory.h"
+#include "src/heap/mark-compact.h"
+#include "src/ic/handler-configuration.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/interpreter/bytecode-generator.h"
 #include "src/interpreter/bytecodes.h"
@@ -30,7 +33,8 @@ typedef InterpreterAssembler::Arg Arg;
 
 #define __ assembler->
 
-Interpreter::Interpreter(Isolate* isolate) : isolate_(isolate) {
+Interpreter::Interpreter(Isolate* isolate)
+    : isolate_(isolate), trampoline_copies_sequence_(0) {
   memset(dispatch_table_, 0, sizeof(dispatch_table_));
 }
 
@@ -127,6 +131,67 @@ void Interpreter::IterateDispatchTable(ObjectVisitor* v) {
   }
 }
 
+void Interpreter::AddTrampolineCopy(Code* copy) {
+  DCHECK(copy->is_interpreter_trampoline_builtin());
+  Address start = copy->instruction_start();
+  BeginTrampolineCopiesUpdate();
+  trampoline_copies_.insert(std::upper_bound(trampoline_copies_.begin(),
+                                             trampoline_copies_.end(), start),
+                            start);
+  EndTrampolineCopiesUpdate();
+}
+
+bool Interpreter::IsTrampolineCopyPc(Address pc) {
+  // The profiler either interrupts the thread running this isolate or
+  // suspends it, so the copies cannot change while we look at them unless
+  // an update was already in progress.
+  if (base::Acquire_Load(&trampoline_copies_sequence_) & 1) return false;
+  std::vector<Address>::const_iterator it = std::upper_bound(
+      trampoline_copies_.begin(), trampoline_copies_.end(), pc);
+  if (it == trampoline_copies_.begin()) return false;
+  // All copies have the size of the original.
+  Code* trampoline =
+      isolate_->builtins()->builtin(Builtins::kInterpreterEntryTrampoline);
+  return pc < *(it - 1) + trampoline->instruction_size();
+}
+
+void Interpreter::ClearDeadTrampolineCopies() {
+  if (trampoline_copies_.empty()) return;
+  BeginTrampolineCopiesUpdate();
+  trampoline_copies_.erase(
+      std::remove_if(trampoline_copies_.begin(), trampoline_copies_.end(),
+                     [](Address start) {
+                       Code* copy = Code::GetCodeFromTargetAddress(start);
+                       return !Marking::IsBlackOrGrey(
+                           ObjectMarking::MarkBitFrom(copy));
+                     }),
+      trampoline_copies_.end());
+  EndTrampolineCopiesUpdate();
+}
+
+void Interpreter::UpdateTrampolineCopiesAfterEvacuation() {
+  if (trampoline_copies_.empty()) return;
+  BeginTrampolineCopiesUpdate();
+  for (Address& start : trampoline_copies_) {
+    MapWord map_word = Code::GetCodeFromTargetAddress(start)->map_word();
+    if (map_word.IsForwardingAddress()) {
+      start = Code::cast(map_word.ToForwardingAddress())->instruction_start();
+    }
+  }
+  std::sort(trampoline_copies_.begin(), trampoline_copies_.end());
+  EndTrampolineCopiesUpdate();
+}
+
+void Interpreter::BeginTrampolineCopiesUpdate() {
+  DCHECK_EQ(0, trampoline_copies_sequence_ & 1);
+  base::Barrier_AtomicIncrement(&trampoline_copies_sequence_, 1);
+}
+
+void Interpreter::EndTrampolineCopiesUpdate() {
+  DCHECK_EQ(1, trampoline_copies_sequence_ & 1);
+  base::Barrier_AtomicIncrement(&trampoline_copies_sequence_, 1);
+}
+
 // static
 int Interpreter::InterruptBudget() {
   // TODO(ignition): Tune code size multiplier.
@@ -169,7 +234,15 @@ bool Interpreter::MakeBytecode(CompilationInfo* info) {
   }
 
   info->SetBytecodeArray(bytecodes);
-  info->SetCode(info->isolate()->builtins()->InterpreterEntryTrampoline());
+  Handle<Code> trampoline =
+      info->isolate()->builtins()->InterpreterEntryTrampoline();
+  if (FLAG_interpreted_frames_native_stack) {
+    // Give the function a copy of the trampoline at a distinct address so
+    // that native stack samples can be attributed to it.
+    trampoline = info->isolate()->factory()->CopyCode(trampoline);
+    info->isolate()->interpreter()->AddTrampolineCopy(*trampoline);
+  }
+  info->SetCode(trampoline);
   return true;
 }
 
@@ -371,6 +444,34 @@ void Interpreter::DoStar(InterpreterAssembler* assembler) {
   __ Dispatch();
 }
 
+// Star<N>
+//
+// Store accumulator to register r<N>. Short form of Star with the register
+// operand encoded in the bytecode.
+#define SHORT_STAR(Name, ...)                                                  \
+  void Interpreter::Do##Name(InterpreterAssembler* assembler) {                \
+    Register reg(Bytecodes::GetShortFormRegisterIndex(Bytecode::k##Name));     \
+    Node* accumulator = __ GetAccumulator();                                   \
+    __ StoreRegister(accumulator, reg);                                        \
+    __ Dispatch();                                                             \
+  }
+SHORT_STAR_BYTECODE_LIST(SHORT_STAR);
+#undef SHORT_STAR
+
+// Ldar<N>
+//
+// Load accumulator with value from register r<N>. Short form of Ldar with the
+// register operand encoded in the bytecode.
+#define SHORT_LDAR(Name, ...)                                                  \
+  void Interpreter::Do##Name(InterpreterAssembler* assembler) {                \
+    Register reg(Bytecodes::GetShortFormRegisterIndex(Bytecode::k##Name));     \
+    Node* value = __ LoadRegister(reg);                                        \
+    __ SetAccumulator(value);                                                  \
+    __ Dispatch();                                                             \
+  }
+SHORT_LDAR_BYTECODE_LIST(SHORT_LDAR);
+#undef SHORT_LDAR
+
 // Mov <src> <dst>
 //
 // Stores the value of register <src> to register <dst>.
@@ -382,20 +483,48 @@ void Interpreter::DoMov(InterpreterAssembler* assembler) {
   __ Dispatch();
 }
 
-Node* Interpreter::BuildLoadGlobal(Callable ic,
+Node* Interpreter::BuildLoadGlobal(Callable ic, TypeofMode typeof_mode,
                                    InterpreterAssembler* assembler) {
   typedef LoadGlobalWithVectorDescriptor Descriptor;
+  Variable var_result(assembler, MachineRepresentation::kTagged);
+  Label call_ic(assembler), end(assembler);
+
   // Get the global object.
   Node* context = __ GetContext();
 
-  // Load the global via the LoadGlobalIC.
-  Node* code_target = __ HeapConstant(ic.code());
   Node* raw_slot = __ BytecodeOperandIdx(0);
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
-  return __ CallStub(ic.descriptor(), code_target, context,
-                     Arg(Descriptor::kSlot, smi_slot),
-                     Arg(Descriptor::kVector, type_feedback_vector));
+
+  // The LoadGlobalIC finds the name of the global in the feedback vector,
+  // so functions whose vector is still pending load it in the runtime.
+  Label call_runtime(assembler, Label::kDeferred);
+  __ Branch(__ IsFeedbackVectorPending(type_feedback_vector), &call_runtime,
+            &call_ic);
+
+  __ Bind(&call_runtime);
+  {
+    Node* closure = __ LoadRegister(Register::function_closure());
+    Node* result = __ CallRuntime(
+        Runtime::kInterpreterLoadGlobalWithoutFeedback, context, closure,
+        smi_slot, __ SmiConstant(Smi::FromInt(typeof_mode)));
+    var_result.Bind(result);
+    __ Goto(&end);
+  }
+
+  // Load the global via the LoadGlobalIC.
+  __ Bind(&call_ic);
+  {
+    Node* code_target = __ HeapConstant(ic.code());
+    Node* result = __ CallStub(ic.descriptor(), code_target, context,
+                               Arg(Descriptor::kSlot, smi_slot),
+                               Arg(Descriptor::kVector, type_feedback_vector));
+    var_result.Bind(result);
+    __ Goto(&end);
+  }
+
+  __ Bind(&end);
+  return var_result.value();
 }
 
 // LdaGlobal <slot>
@@ -405,7 +534,7 @@ Node* Interpreter::BuildLoadGlobal(Callable ic,
 void Interpreter::DoLdaGlobal(InterpreterAssembler* assembler) {
   Callable ic =
       CodeFactory::LoadGlobalICInOptimizedCode(isolate_, NOT_INSIDE_TYPEOF);
-  Node* result = BuildLoadGlobal(ic, assembler);
+  Node* result = BuildLoadGlobal(ic, NOT_INSIDE_TYPEOF, assembler);
   __ SetAccumulator(result);
   __ Dispatch();
 }
@@ -417,7 +546,7 @@ void Interpreter::DoLdaGlobal(InterpreterAssembler* assembler) {
 void Interpreter::DoLdrGlobal(InterpreterAssembler* assembler) {
   Callable ic =
       CodeFactory::LoadGlobalICInOptimizedCode(isolate_, NOT_INSIDE_TYPEOF);
-  Node* result = BuildLoadGlobal(ic, assembler);
+  Node* result = BuildLoadGlobal(ic, NOT_INSIDE_TYPEOF, assembler);
   Node* destination = __ BytecodeOperandReg(1);
   __ StoreRegister(result, destination);
   __ Dispatch();
@@ -430,7 +559,7 @@ void Interpreter::DoLdrGlobal(InterpreterAssembler* assembler) {
 void Interpreter::DoLdaGlobalInsideTypeof(InterpreterAssembler* assembler) {
   Callable ic =
       CodeFactory::LoadGlobalICInOptimizedCode(isolate_, INSIDE_TYPEOF);
-  Node* result = BuildLoadGlobal(ic, assembler);
+  Node* result = BuildLoadGlobal(ic, INSIDE_TYPEOF, assembler);
   __ SetAccumulator(result);
   __ Dispatch();
 }
@@ -451,6 +580,8 @@ void Interpreter::DoStaGlobal(Callable ic, InterpreterAssembler* assembler) {
   Node* raw_slot = __ BytecodeOperandIdx(1);
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
+  __ UseDummyFeedbackIfPending(TypeFeedbackVector::kDummyStoreICSlot,
+                               &type_feedback_vector, &smi_slot);
   __ CallStub(ic.descriptor(), code_target, context,
               Arg(Descriptor::kReceiver, global), Arg(Descriptor::kName, name),
               Arg(Descriptor::kValue, value), Arg(Descriptor::kSlot, smi_slot),
@@ -574,19 +705,93 @@ void Interpreter::DoStaLookupSlotStrict(InterpreterAssembler* assembler) {
 Node* Interpreter::BuildLoadNamedProperty(Callable ic,
                                           InterpreterAssembler* assembler) {
   typedef LoadWithVectorDescriptor Descriptor;
-  Node* code_target = __ HeapConstant(ic.code());
+  Variable var_result(assembler, MachineRepresentation::kTagged);
+  Label call_ic(assembler, Label::kDeferred), end(assembler);
+
   Node* register_index = __ BytecodeOperandReg(0);
   Node* object = __ LoadRegister(register_index);
-  Node* constant_index = __ BytecodeOperandIdx(1);
-  Node* name = __ LoadConstantPoolEntry(constant_index);
   Node* raw_slot = __ BytecodeOperandIdx(2);
-  Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
-  Node* context = __ GetContext();
-  return __ CallStub(
-      ic.descriptor(), code_target, context, Arg(Descriptor::kReceiver, object),
-      Arg(Descriptor::kName, name), Arg(Descriptor::kSlot, smi_slot),
-      Arg(Descriptor::kVector, type_feedback_vector));
+
+  if (FLAG_tf_load_ic_stub) {
+    // Handle the common case where the feedback slot is monomorphic and its
+    // handler is a Smi encoding a field load (see LoadHandler::LoadField)
+    // without calling the LoadIC. Only field handlers with the double bit
+    // clear are loaded inline; everything else, including constant handlers,
+    // goes through the IC.
+    Label if_inobject(assembler), if_out_of_object(assembler);
+
+    __ GotoIf(__ WordIsSmi(object), &call_ic);
+    __ GotoIf(__ IsFeedbackVectorPending(type_feedback_vector), &call_ic);
+    Node* receiver_map = __ LoadMap(object);
+
+    Node* feedback_offset = __ IntPtrAdd(
+        __ IntPtrConstant(FixedArray::kHeaderSize - kHeapObjectTag),
+        __ WordShl(raw_slot, kPointerSizeLog2));
+    Node* feedback = __ Load(MachineType::AnyTagged(), type_feedback_vector,
+                             feedback_offset);
+    // It is safe to look at WeakCell::kValueOffset without knowing whether
+    // the feedback is a weak cell, see CodeStubAssembler::TryMonomorphicCase.
+    __ GotoUnless(__ WordEqual(receiver_map, __ LoadWeakCellValue(feedback)),
+                  &call_ic);
+
+    Node* handler = __ Load(
+        MachineType::AnyTagged(), type_feedback_vector,
+        __ IntPtrAdd(feedback_offset, __ IntPtrConstant(kPointerSize)));
+    __ GotoUnless(__ WordIsSmi(handler), &call_ic);
+
+    Node* handler_word = __ SmiUntag(handler);
+    Node* kind_bits = __ WordAnd(
+        handler_word, __ IntPtrConstant(LoadHandler::KindBits::kMask |
+                                        LoadHandler::IsDoubleBits::kMask));
+    __ GotoUnless(
+        __ WordEqual(kind_bits, __ IntPtrConstant(LoadHandler::KindBits::encode(
+                                    LoadHandler::kForFields))),
+        &call_ic);
+
+    Node* inobject_bit = __ WordAnd(
+        handler_word,
+        __ IntPtrConstant(LoadHandler::IsInobjectBits::kMask));
+    Node* offset = __ WordSar(
+        handler_word, __ IntPtrConstant(LoadHandler::FieldOffsetBits::kShift));
+    __ BranchIf(__ WordEqual(inobject_bit, __ IntPtrConstant(0)),
+                &if_out_of_object, &if_inobject);
+
+    __ Bind(&if_inobject);
+    {
+      var_result.Bind(__ LoadObjectField(object, offset));
+      __ Goto(&end);
+    }
+
+    __ Bind(&if_out_of_object);
+    {
+      Node* properties = __ LoadProperties(object);
+      var_result.Bind(__ LoadObjectField(properties, offset));
+      __ Goto(&end);
+    }
+  } else {
+    __ Goto(&call_ic);
+  }
+
+  __ Bind(&call_ic);
+  {
+    Node* code_target = __ HeapConstant(ic.code());
+    Node* constant_index = __ BytecodeOperandIdx(1);
+    Node* name = __ LoadConstantPoolEntry(constant_index);
+    Node* smi_slot = __ SmiTag(raw_slot);
+    __ UseDummyFeedbackIfPending(TypeFeedbackVector::kDummyLoadICSlot,
+                                 &type_feedback_vector, &smi_slot);
+    Node* context = __ GetContext();
+    var_result.Bind(__ CallStub(ic.descriptor(), code_target, context,
+                                Arg(Descriptor::kReceiver, object),
+                                Arg(Descriptor::kName, name),
+                                Arg(Descriptor::kSlot, smi_slot),
+                                Arg(Descriptor::kVector, type_feedback_vector)));
+    __ Goto(&end);
+  }
+
+  __ Bind(&end);
+  return var_result.value();
 }
 
 // LdaNamedProperty <object> <name_index> <slot>
@@ -622,6 +827,8 @@ Node* Interpreter::BuildLoadKeyedProperty(Callable ic,
   Node* raw_slot = __ BytecodeOperandIdx(1);
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
+  __ UseDummyFeedbackIfPending(TypeFeedbackVector::kDummyKeyedLoadICSlot,
+                               &type_feedback_vector, &smi_slot);
   Node* context = __ GetContext();
   return __ CallStub(
       ic.descriptor(), code_target, context, Arg(Descriptor::kReceiver, object),
@@ -663,6 +870,8 @@ void Interpreter::DoStoreIC(Callable ic, InterpreterAssembler* assembler) {
   Node* raw_slot = __ BytecodeOperandIdx(2);
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
+  __ UseDummyFeedbackIfPending(TypeFeedbackVector::kDummyStoreICSlot,
+                               &type_feedback_vector, &smi_slot);
   Node* context = __ GetContext();
   __ CallStub(ic.descriptor(), code_target, context,
               Arg(Descriptor::kReceiver, object), Arg(Descriptor::kName, name),
@@ -702,6 +911,8 @@ void Interpreter::DoKeyedStoreIC(Callable ic, InterpreterAssembler* assembler) {
   Node* raw_slot = __ BytecodeOperandIdx(2);
   Node* smi_slot = __ SmiTag(raw_slot);
   Node* type_feedback_vector = __ LoadTypeFeedbackVector();
+  __ UseDummyFeedbackIfPending(TypeFeedbackVector::kDummyKeyedStoreICSlot,
+                               &type_feedback_vector, &smi_slot);
   Node* context = __ GetContext();
   __ CallStub(ic.descriptor(), code_target, context,
               Arg(Descriptor::kReceiver, object), Arg(Descriptor::kName, name),
@@ -1635,13 +1846,61 @@ void Interpreter::DoCreateArrayLiteral(InterpreterAssembler* assembler) {
   Node* literal_index_raw = __ BytecodeOperandIdx(1);
   Node* literal_index = __ SmiTag(literal_index_raw);
   Node* flags_raw = __ BytecodeOperandFlag(2);
-  Node* flags = __ SmiTag(flags_raw);
   Node* closure = __ LoadRegister(Register::function_closure());
   Node* context = __ GetContext();
-  Node* result = __ CallRuntime(Runtime::kCreateArrayLiteral, context, closure,
-                                literal_index, constant_elements, flags);
-  __ SetAccumulator(result);
-  __ Dispatch();
+
+  // Use the FastCloneShallowArrayStub only for shallow boilerplates up to the
+  // initial length limit. The stub clones the boilerplate from the
+  // AllocationSite (sharing copy-on-write elements) and bails out to the
+  // runtime itself if the site has not been created yet.
+  Label fast_shallow_clone(assembler),
+      call_runtime(assembler, Label::kDeferred);
+  Node* shallow_elements = __ Word32And(
+      flags_raw, __ Int32Constant(ArrayLiteral::kShallowElements));
+  __ GotoUnless(shallow_elements, &call_runtime);
+  Node* element_values =
+      __ LoadFixedArrayElement(constant_elements, __ Int32Constant(1));
+  Node* length = __ LoadFixedArrayBaseLength(element_values);
+  Node* max_length =
+      __ SmiConstant(Smi::FromInt(JSArray::kInitialMaxFastElementArray));
+  __ BranchIfSmiLessThan(length, max_length, &fast_shallow_clone,
+                         &call_runtime);
+
+  __ Bind(&fast_shallow_clone);
+  {
+    // Clones have to carry AllocationMementos so that elements kind
+    // transitions and pretenuring decisions reach the AllocationSite. As in
+    // full-codegen, the only use of the mementos for boilerplates that
+    // already have FAST_ELEMENTS or FAST_HOLEY_ELEMENTS is pretenuring.
+    Callable callable =
+        CodeFactory::FastCloneShallowArray(isolate_, TRACK_ALLOCATION_SITE);
+    Node* target = __ HeapConstant(callable.code());
+    if (!FLAG_allocation_site_pretenuring) {
+      Callable dont_track = CodeFactory::FastCloneShallowArray(
+          isolate_, DONT_TRACK_ALLOCATION_SITE);
+      Node* elements_kind = __ SmiUntag(
+          __ LoadFixedArrayElement(constant_elements, __ Int32Constant(0)));
+      Node* is_fast_object_kind = __ Word32Or(
+          __ WordEqual(elements_kind, __ IntPtrConstant(FAST_ELEMENTS)),
+          __ WordEqual(elements_kind, __ IntPtrConstant(FAST_HOLEY_ELEMENTS)));
+      target = __ Select(is_fast_object_kind,
+                         __ HeapConstant(dont_track.code()), target);
+    }
+    Node* result = __ CallStub(callable.descriptor(), target, context, closure,
+                               literal_index, constant_elements);
+    __ SetAccumulator(result);
+    __ Dispatch();
+  }
+
+  __ Bind(&call_runtime);
+  {
+    Node* flags = __ SmiTag(flags_raw);
+    Node* result =
+        __ CallRuntime(Runtime::kCreateArrayLiteral, context, closure,
+                       literal_index, constant_elements, flags);
+    __ SetAccumulator(result);
+    __ Dispatch();
+  }
 }
 
 // CreateObjectLiteral <element_idx> <literal_idx> <flags>
@@ -1867,6 +2126,7 @@ void Interpreter::DoReThrow(InterpreterAssembler* assembler) {
 // Return the value in the accumulator.
 void Interpreter::DoReturn(InterpreterAssembler* assembler) {
   __ UpdateInterruptBudgetOnReturn();
+  __ UpdateFeedbackAllocationBudgetOnReturn();
   Node* accumulator = __ GetAccumulator();
   __ Return(accumulator);
 }
@@ -2032,12 +2292,17 @@ void Interpreter::DoForInNext(InterpreterAssembler* assembler) {
   __ Bind(&if_slow);
   {
     // Record the fact that we hit the for-in slow path.
+    Label filter(assembler);
     Node* vector_index = __ BytecodeOperandIdx(3);
     Node* type_feedback_vector = __ LoadTypeFeedbackVector();
+    __ GotoIf(__ IsFeedbackVectorPending(type_feedback_vector), &filter);
     Node* megamorphic_sentinel =
         __ HeapConstant(TypeFeedbackVector::MegamorphicSentinel(isolate_));
     __ StoreFixedArrayElement(type_feedback_vector, vector_index,
                               megamorphic_sentinel, SKIP_WRITE_BARRIER);
+    __ Goto(&filter);
+
+    __ Bind(&filter);
 
     // Need to filter the {key} for the {receiver}.
     Node* context = __ GetContext();
@@ -6,10 +6,12 @@
 #define V8_INTERPRETER_INTERPRETER_H_
 
 #include <memory>
+#include <vector>
 
 // Clients of this interface shouldn't depend on lots of interpreter internals.
 // Do not include anything from src/interpreter other than
 // src/interpreter/bytecodes.h here!
+#include "src/base/atomicops.h"
 #include "src/base/macros.h"
 #include "src/builtins/builtins.h"
 #include "src/interpreter/bytecodes.h"
@@ -51,6 +53,21 @@ class Interpreter {
   // GC support.
   void IterateDispatchTable(ObjectVisitor* v);
 
+  // Per-function copies of the InterpreterEntryTrampoline, made for
+  // --interpreted-frames-native-stack, are tracked by address so that the
+  // profiler can recognize them without touching the heap.
+  void AddTrampolineCopy(Code* copy);
+
+  // Returns true if |pc| lies within one of the trampoline copies. Safe to
+  // call from the profiler's signal handler; answers false while the set of
+  // copies is being updated.
+  bool IsTrampolineCopyPc(Address pc);
+
+  // Called by the mark-compact collector to forget copies that were not
+  // marked and to follow copies that were evacuated.
+  void ClearDeadTrampolineCopies();
+  void UpdateTrampolineCopiesAfterEvacuation();
+
   // Disassembler support (only useful with ENABLE_DISASSEMBLER defined).
   void TraceCodegen(Handle<Code> code);
   const char* LookupNameOfBytecodeHandler(Code* code);
@@ -136,7 +153,8 @@ class Interpreter {
   compiler::Node* BuildLoadContextSlot(InterpreterAssembler* assembler);
 
   // Generates code to load a global.
-  compiler::Node* BuildLoadGlobal(Callable ic, InterpreterAssembler* assembler);
+  compiler::Node* BuildLoadGlobal(Callable ic, TypeofMode typeof_mode,
+                                  InterpreterAssembler* assembler);
 
   // Generates code to load a named property.
   compiler::Node* BuildLoadNamedProperty(Callable ic,
@@ -167,6 +185,10 @@ class Interpreter {
 
   bool IsDispatchTableInitialized();
 
+  // Marks the start and the end of an update of |trampoline_copies_|.
+  void BeginTrampolineCopiesUpdate();
+  void EndTrampolineCopiesUpdate();
+
   static const int kNumberOfWideVariants = 3;
   static const int kDispatchTableSize = kNumberOfWideVariants * (kMaxUInt8 + 1);
   static const int kNumberOfBytecodes = static_cast<int>(Bytecode::kLast) + 1;
@@ -175,6 +197,11 @@ class Interpreter {
   Address dispatch_table_[kDispatchTableSize];
   std::unique_ptr<uintptr_t[]> bytecode_dispatch_counters_table_;
 
+  // Sorted instruction starts of the trampoline copies. The sequence number
+  // is odd while the vector is being modified.
+  std::vector<Address> trampoline_copies_;
+  base::Atomic32 trampoline_copies_sequence_;
+
   DISALLOW_COPY_AND_ASSIGN(Interpreter);
 };
 
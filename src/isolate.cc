@@ -439,11 +439,8 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
 
   // Get stack trace limit.
   Handle<JSObject> error = error_function();
-  Handle<String> stackTraceLimit =
-      factory()->InternalizeUtf8String("stackTraceLimit");
-  DCHECK(!stackTraceLimit.is_null());
-  Handle<Object> stack_trace_limit =
-      JSReceiver::GetDataProperty(error, stackTraceLimit);
+  Handle<Object> stack_trace_limit = JSReceiver::GetDataProperty(
+      error, factory()->stackTraceLimit_string());
   if (!stack_trace_limit->IsNumber()) return factory()->undefined_value();
   int limit = FastD2IChecked(stack_trace_limit->Number());
   limit = Max(limit, 0);  // Ensure that limit is not negative.
@@ -457,19 +454,49 @@ Handle<Object> Isolate::CaptureSimpleStackTrace(Handle<JSReceiver> error_object,
   // First element is reserved to store the number of sloppy frames.
   int cursor = 1;
   int frames_seen = 0;
+  // Set initial size to the maximum inlining level + 1 for the outermost
+  // function. The list is reused across frames.
+  List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
   for (StackFrameIterator iter(this); !iter.done() && frames_seen < limit;
        iter.Advance()) {
     StackFrame* frame = iter.frame();
 
     switch (frame->type()) {
       case StackFrame::JAVA_SCRIPT:
+      case StackFrame::INTERPRETED: {
+        // Unoptimized frames never contain inlined functions, so the raw
+        // function, receiver, code and offset are read straight off the frame
+        // instead of going through a FrameSummary.
+        JavaScriptFrame* js_frame = JavaScriptFrame::cast(frame);
+        if (!helper.IsVisibleInStackTrace(js_frame->function())) continue;
+        helper.CountSloppyFrames(js_frame->function());
+
+        // Grow before reading any raw pointers, since it may cause a GC.
+        elements = MaybeGrow(this, elements, cursor, cursor + 4);
+        AbstractCode* abstract_code;
+        int offset;
+        if (frame->is_interpreted()) {
+          InterpretedFrame* interpreted_frame =
+              static_cast<InterpretedFrame*>(js_frame);
+          abstract_code = AbstractCode::cast(
+              js_frame->function()->shared()->bytecode_array());
+          offset = interpreted_frame->GetBytecodeOffset();
+        } else {
+          Code* code = js_frame->LookupCode();
+          abstract_code = AbstractCode::cast(code);
+          offset = static_cast<int>(js_frame->pc() - code->instruction_start());
+        }
+        elements->set(cursor++, js_frame->receiver());
+        elements->set(cursor++, js_frame->function());
+        elements->set(cursor++, abstract_code);
+        elements->set(cursor++, Smi::FromInt(offset));
+        frames_seen++;
+      } break;
+
       case StackFrame::OPTIMIZED:
-      case StackFrame::INTERPRETED:
       case StackFrame::BUILTIN: {
         JavaScriptFrame* js_frame = JavaScriptFrame::cast(frame);
-        // Set initial size to the maximum inlining level + 1 for the outermost
-        // function.
-        List<FrameSummary> frames(FLAG_max_inlining_levels + 1);
+        frames.Rewind(0);
         js_frame->Summarize(&frames);
         for (int i = frames.length() - 1; i >= 0; i--) {
           Handle<JSFunction> fun = frames[i].function();
@@ -1867,18 +1894,29 @@ class VerboseAccountingAllocator : public base::AccountingAllocator {
 
   void* Allocate(size_t size) override {
     void* memory = base::AccountingAllocator::Allocate(size);
-    if (memory) {
-      size_t current = GetCurrentMemoryUsage();
-      if (last_memory_usage_.Value() + sample_bytes_ < current) {
-        PrintJSON(current);
-        last_memory_usage_.SetValue(current);
-      }
-    }
+    if (memory) SampleGrowth();
     return memory;
   }
 
   void Free(void* memory, size_t bytes) override {
     base::AccountingAllocator::Free(memory, bytes);
+    SampleShrinkage();
+  }
+
+ protected:
+  void OnSegmentReused(size_t bytes) override { SampleGrowth(); }
+  void OnSegmentPooled(size_t bytes) override { SampleShrinkage(); }
+
+ private:
+  void SampleGrowth() {
+    size_t current = GetCurrentMemoryUsage();
+    if (last_memory_usage_.Value() + sample_bytes_ < current) {
+      PrintJSON(current);
+      last_memory_usage_.SetValue(current);
+    }
+  }
+
+  void SampleShrinkage() {
     size_t current = GetCurrentMemoryUsage();
     if (current + sample_bytes_ < last_memory_usage_.Value()) {
       PrintJSON(current);
@@ -1886,7 +1924,9 @@ class VerboseAccountingAllocator : public base::AccountingAllocator {
     }
   }
 
- private:
+  // Only samples that differ from the previous one by more than
+  // {sample_bytes_} get printed, which keeps the trace compact even with
+  // zone segments being recycled through the segment pool all the time.
   void PrintJSON(size_t sample) {
     // Note: Neither isolate, nor heap is locked, so be careful with accesses
     // as the allocator is potentially used on a concurrent thread.
@@ -1896,9 +1936,12 @@ class VerboseAccountingAllocator : public base::AccountingAllocator {
         "\"type\": \"malloced\", "
         "\"isolate\": \"%p\", "
         "\"time\": %f, "
-        "\"value\": %zu"
+        "\"value\": %zu, "
+        "\"max\": %zu, "
+        "\"pooled\": %zu"
         "}\n",
-        reinterpret_cast<void*>(heap_->isolate()), time, sample);
+        reinterpret_cast<void*>(heap_->isolate()), time, sample,
+        GetMaxMemoryUsage(), GetCurrentPoolSize());
   }
 
   Heap* heap_;
@@ -1931,7 +1974,7 @@ Isolate::Isolate(bool enable_serializer)
       descriptor_lookup_cache_(NULL),
       handle_scope_implementer_(NULL),
       unicode_cache_(NULL),
-      allocator_(FLAG_trace_gc_object_stats
+      allocator_(FLAG_trace_gc_object_stats || FLAG_trace_zone_stats
                      ? new VerboseAccountingAllocator(&heap_, 256 * KB)
                      : new base::AccountingAllocator()),
       runtime_zone_(new Zone(allocator_)),
@@ -1989,6 +2032,10 @@ Isolate::Isolate(bool enable_serializer)
   thread_manager_ = new ThreadManager();
   thread_manager_->isolate_ = this;
 
+  // Recycle zone segments across parses and compilations.
+  allocator_->ConfigureSegmentPool(
+      static_cast<size_t>(FLAG_zone_segment_pool_size) * KB);
+
 #ifdef DEBUG
   // heap_histograms_ initializes itself.
   memset(&js_spill_information_, 0, sizeof(js_spill_information_));
@@ -121,6 +121,10 @@ template <bool seq_one_byte>
 MaybeHandle<Object> JsonParser<seq_one_byte>::ParseJson() {
   // Advance to the first character (possibly EOS)
   AdvanceSkipWhitespace();
+  if (seq_one_byte && (c0_ == '{' || c0_ == '[')) {
+    transition_cache_ = factory()->NewFixedArray(
+        kTransitionCacheSize * kTransitionCacheEntrySize);
+  }
   Handle<Object> result = ParseJsonValue();
   if (result.is_null() || c0_ != kEndOfString) {
     // Some exception (for example stack overflow) is already pending.
@@ -367,11 +371,17 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
       if (seq_one_byte) {
         key = TransitionArray::ExpectedTransitionKey(map);
         follow_expected = !key.is_null() && ParseJsonString(key);
+        // If the expected transition hits, follow it.
+        if (follow_expected) {
+          target = TransitionArray::ExpectedTransitionTarget(map);
+        } else if (key.is_null()) {
+          // The map has several transitions. Objects in a JSON document
+          // mostly share their shape, so try the transition that was taken
+          // from this map last time.
+          follow_expected = FollowCachedTransition(map, &key, &target);
+        }
       }
-      // If the expected transition hits, follow it.
-      if (follow_expected) {
-        target = TransitionArray::ExpectedTransitionTarget(map);
-      } else {
+      if (!follow_expected) {
         // If the expected transition failed, parse an internalized string and
         // try to find a matching transition.
         key = ParseJsonInternalizedString();
@@ -380,6 +390,7 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
         target = TransitionArray::FindTransitionToField(map, key);
         // If a transition was found, follow it and continue.
         transitioning = !target.is_null();
+        if (seq_one_byte && transitioning) CacheTransition(map, key, target);
       }
       if (c0_ != ':') return ReportUnexpectedCharacter();
 
@@ -470,6 +481,49 @@ Handle<Object> JsonParser<seq_one_byte>::ParseJsonObject() {
   return scope.CloseAndEscape(json_object);
 }
 
+template <bool seq_one_byte>
+int JsonParser<seq_one_byte>::TransitionCacheIndex(Map* map) {
+  uintptr_t hash = reinterpret_cast<uintptr_t>(map) >> kPointerSizeLog2;
+  return static_cast<int>(hash & (kTransitionCacheSize - 1)) *
+         kTransitionCacheEntrySize;
+}
+
+template <bool seq_one_byte>
+bool JsonParser<seq_one_byte>::FollowCachedTransition(Handle<Map> map,
+                                                      Handle<String>* key,
+                                                      Handle<Map>* target) {
+  DCHECK(seq_one_byte);
+  if (transition_cache_.is_null()) return false;
+  int index = TransitionCacheIndex(*map);
+  if (transition_cache_->get(index + kTransitionCacheMapOffset) != *map) {
+    return false;
+  }
+  Handle<String> cached_key(
+      String::cast(transition_cache_->get(index + kTransitionCacheKeyOffset)),
+      isolate());
+  Map* cached_target =
+      Map::cast(transition_cache_->get(index + kTransitionCacheTargetOffset));
+  // Map migrations triggered by the slow path below may have deprecated the
+  // target in the meantime.
+  if (cached_target->is_deprecated()) return false;
+  if (!ParseJsonString(cached_key)) return false;
+  *key = cached_key;
+  *target = handle(cached_target, isolate());
+  return true;
+}
+
+template <bool seq_one_byte>
+void JsonParser<seq_one_byte>::CacheTransition(Handle<Map> map,
+                                               Handle<String> key,
+                                               Handle<Map> target) {
+  DCHECK(seq_one_byte);
+  if (transition_cache_.is_null()) return;
+  int index = TransitionCacheIndex(*map);
+  transition_cache_->set(index + kTransitionCacheMapOffset, *map);
+  transition_cache_->set(index + kTransitionCacheKeyOffset, *key);
+  transition_cache_->set(index + kTransitionCacheTargetOffset, *target);
+}
+
 template <bool seq_one_byte>
 void JsonParser<seq_one_byte>::CommitStateToJsonObject(
     Handle<JSObject> json_object, Handle<Map> map,
@@ -776,8 +830,16 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
   }
 
   int beg_pos = position_;
+  if (seq_one_byte) {
+    // Skip ahead to the first character that needs a closer look.
+    position_ += String::JsonEscapeStart(seq_source_->GetChars() + position_,
+                                         source_length_ - position_);
+    c0_ = position_ < source_length_
+              ? seq_source_->SeqOneByteStringGet(position_)
+              : kEndOfString;
+  }
   // Fast case for Latin1 only without escape characters.
-  do {
+  while (c0_ != '"') {
     // Check for control character (0x00-0x1f) or unterminated string (<0).
     if (c0_ < 0x20) return Handle<String>::null();
     if (c0_ != '\\') {
@@ -791,7 +853,7 @@ Handle<String> JsonParser<seq_one_byte>::ScanJsonString() {
       return SlowScanJsonString<SeqOneByteString, uint8_t>(source_, beg_pos,
                                                            position_);
     }
-  } while (c0_ != '"');
+  }
   int length = position_ - beg_pos;
   Handle<String> result =
       factory()->NewRawOneByteString(length, pretenure_).ToHandleChecked();
@@ -146,6 +146,25 @@ class JsonParser BASE_EMBEDDED {
   void CommitStateToJsonObject(Handle<JSObject> json_object, Handle<Map> map,
                                ZoneList<Handle<Object> >* properties);
 
+  // A small direct-mapped cache of the last field transition taken from a
+  // map while parsing the current source. It lets ParseJsonObject follow the
+  // transition chain of a repeated object shape by matching the raw key
+  // characters, even where the transition tree branches, instead of
+  // internalizing every key and searching the transition array. Entries are
+  // keyed by map address, so they simply miss after a moving GC.
+  static const int kTransitionCacheSize = 32;
+  static const int kTransitionCacheMapOffset = 0;
+  static const int kTransitionCacheKeyOffset = 1;
+  static const int kTransitionCacheTargetOffset = 2;
+  static const int kTransitionCacheEntrySize = 3;
+
+  static int TransitionCacheIndex(Map* map);
+  // On a hit, consumes the key and returns the cached key and target map.
+  bool FollowCachedTransition(Handle<Map> map, Handle<String>* key,
+                              Handle<Map>* target);
+  void CacheTransition(Handle<Map> map, Handle<String> key,
+                       Handle<Map> target);
+
   Handle<String> source_;
   int source_length_;
   Handle<SeqOneByteString> seq_source_;
@@ -155,6 +174,7 @@ class JsonParser BASE_EMBEDDED {
   Factory* factory_;
   Zone zone_;
   Handle<JSFunction> object_constructor_;
+  Handle<FixedArray> transition_cache_;
   uc32 c0_;
   int position_;
 };
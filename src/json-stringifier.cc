@@ -627,6 +627,21 @@ void JsonStringifier::SerializeStringUnchecked_(
   // The <uc16, char> version of this method must not be called.
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
 
+  if (sizeof(SrcChar) == 1) {
+    // Copy runs of characters that need no escaping in bulk.
+    const uint8_t* chars = reinterpret_cast<const uint8_t*>(src.start());
+    int length = src.length();
+    int i = 0;
+    while (true) {
+      int run = String::JsonEscapeStart(chars + i, length - i);
+      dest->AppendChars(src.start() + i, run);
+      i += run;
+      if (i == length) return;
+      dest->AppendCString(
+          &JsonEscapeTable[chars[i++] * kJsonEscapeTableEntrySize]);
+    }
+  }
+
   for (int i = 0; i < src.length(); i++) {
     SrcChar c = src[i];
     if (DoNotEscape(c)) {
@@ -257,12 +257,14 @@ PerfBasicLogger::~PerfBasicLogger() {
   perf_output_handle_ = NULL;
 }
 
-void PerfBasicLogger::LogRecordedBuffer(AbstractCode* code, SharedFunctionInfo*,
+void PerfBasicLogger::LogRecordedBuffer(AbstractCode* code,
+                                        SharedFunctionInfo* shared,
                                         const char* name, int length) {
   if (FLAG_perf_basic_prof_only_functions &&
       (code->kind() != AbstractCode::FUNCTION &&
        code->kind() != AbstractCode::INTERPRETED_FUNCTION &&
-       code->kind() != AbstractCode::OPTIMIZED_FUNCTION)) {
+       code->kind() != AbstractCode::OPTIMIZED_FUNCTION) &&
+      !Logger::IsFunctionTrampoline(code, shared)) {
     return;
   }
 
@@ -419,6 +421,231 @@ void LowLevelLogger::CodeMovingGCEvent() {
 #define JIT_LOG(Call) if (jit_logger_) jit_logger_->Call;
 
 
+// Compact binary logging of --prof ticks and code events (--prof-binary).
+// Every record is written with a single fwrite into a large stdio buffer, so
+// records from the main, GC and profiler threads never interleave and no
+// per-record flush is needed. The format is read by
+// tools/binary-tickprocessor.cc; keep the two in sync.
+class BinaryProfLogger : public CodeEventLogger {
+ public:
+  explicit BinaryProfLogger(const char* file_name);
+  ~BinaryProfLogger() override;
+
+  void CodeMoveEvent(AbstractCode* from, Address to) override;
+  void CodeDisableOptEvent(AbstractCode* code,
+                           SharedFunctionInfo* shared) override {}
+  void CallbackEvent(Name* name, Address entry_point) override;
+  void GetterCallbackEvent(Name* name, Address entry_point) override;
+  void SetterCallbackEvent(Name* name, Address entry_point) override;
+
+  void SharedLibraryEvent(const std::string& library_path, uintptr_t start,
+                          uintptr_t end, intptr_t aslr_slide);
+  void TickEvent(v8::TickSample* sample, bool overflow, int time_us);
+
+ private:
+  void LogRecordedBuffer(AbstractCode* code, SharedFunctionInfo* shared,
+                         const char* name, int length) override;
+  void LogCodeCreate(uint64_t address, uint32_t size, const char* prefix,
+                     const char* name, int length);
+  void CallbackEventInternal(const char* prefix, Name* name,
+                             Address entry_point);
+
+  struct FileHeader {
+    char magic[4];
+    uint32_t version;
+  };
+
+  // All addresses are stored as 64 bit values, so that the processor does not
+  // need to know the pointer size of the profiled process.
+  struct CodeCreateStruct {
+    static const char kTag = 'C';
+
+    uint64_t code_address;
+    uint32_t code_size;
+    uint32_t name_size;
+  };
+
+  struct CodeMoveStruct {
+    static const char kTag = 'M';
+
+    uint64_t from_address;
+    uint64_t to_address;
+  };
+
+  struct SharedLibraryStruct {
+    static const char kTag = 'L';
+
+    uint64_t start;
+    uint64_t end;
+    int64_t aslr_slide;
+    uint32_t name_size;
+    uint32_t reserved;
+  };
+
+  struct TickStruct {
+    static const char kTag = 'T';
+
+    uint64_t pc;
+    uint64_t tos_or_external_callback;
+    uint32_t time_us;
+    uint8_t vm_state;
+    uint8_t has_external_callback;
+    uint8_t overflow;
+    uint8_t frames_count;
+    // Followed by frames_count 64 bit frame addresses.
+  };
+
+  static const uint32_t kVersion = 1;
+  static const int kLogBufferSize = 2 * MB;
+  // Large enough for any record but code creations with long names, which
+  // are truncated.
+  static const int kRecordBufferSize =
+      1 + sizeof(TickStruct) + v8::TickSample::kMaxFramesCount * 8;
+
+  // Extension added to V8 log file name to get the binary log name.
+  static const char kLogExt[];
+
+  template <typename T>
+  void LogWriteStruct(const T& s, const char* payload, int payload_size);
+
+  FILE* output_handle_;
+};
+
+const char BinaryProfLogger::kLogExt[] = ".bin";
+
+BinaryProfLogger::BinaryProfLogger(const char* name) : output_handle_(NULL) {
+  size_t len = strlen(name);
+  ScopedVector<char> bin_name(static_cast<int>(len + sizeof(kLogExt)));
+  MemCopy(bin_name.start(), name, len);
+  MemCopy(bin_name.start() + len, kLogExt, sizeof(kLogExt));
+  output_handle_ =
+      base::OS::FOpen(bin_name.start(), base::OS::LogFileOpenMode);
+  if (output_handle_ == NULL) return;
+  setvbuf(output_handle_, NULL, _IOFBF, kLogBufferSize);
+
+  FileHeader header = {{'V', '8', 'P', 'B'}, kVersion};
+  fwrite(&header, sizeof(header), 1, output_handle_);
+}
+
+BinaryProfLogger::~BinaryProfLogger() {
+  if (output_handle_ == NULL) return;
+  fclose(output_handle_);
+  output_handle_ = NULL;
+}
+
+template <typename T>
+void BinaryProfLogger::LogWriteStruct(const T& s, const char* payload,
+                                      int payload_size) {
+  if (output_handle_ == NULL) return;
+  char buffer[kRecordBufferSize];
+  DCHECK_LE(1 + sizeof(s) + payload_size, sizeof(buffer));
+  buffer[0] = T::kTag;
+  MemCopy(buffer + 1, &s, sizeof(s));
+  if (payload_size > 0) MemCopy(buffer + 1 + sizeof(s), payload, payload_size);
+  // A single fwrite keeps the record contiguous, since stdio serializes
+  // concurrent calls on the same stream.
+  fwrite(buffer, 1 + sizeof(s) + payload_size, 1, output_handle_);
+}
+
+void BinaryProfLogger::LogCodeCreate(uint64_t address, uint32_t size,
+                                     const char* prefix, const char* name,
+                                     int length) {
+  static const int kMaxNameSize =
+      kRecordBufferSize - 1 - static_cast<int>(sizeof(CodeCreateStruct));
+  char name_buffer[kMaxNameSize];
+  int prefix_length = Min(StrLength(prefix), kMaxNameSize);
+  MemCopy(name_buffer, prefix, prefix_length);
+  length = Min(length, kMaxNameSize - prefix_length);
+  MemCopy(name_buffer + prefix_length, name, length);
+
+  CodeCreateStruct event;
+  event.code_address = address;
+  event.code_size = size;
+  event.name_size = prefix_length + length;
+  LogWriteStruct(event, name_buffer, event.name_size);
+}
+
+void BinaryProfLogger::LogRecordedBuffer(AbstractCode* code,
+                                         SharedFunctionInfo*, const char* name,
+                                         int length) {
+  LogCodeCreate(reinterpret_cast<uint64_t>(code->instruction_start()),
+                code->instruction_size(), "", name, length);
+}
+
+void BinaryProfLogger::CallbackEventInternal(const char* prefix, Name* name,
+                                             Address entry_point) {
+  std::unique_ptr<char[]> str;
+  if (name->IsString()) {
+    str = String::cast(name)->ToCString(DISALLOW_NULLS,
+                                        ROBUST_STRING_TRAVERSAL);
+  } else if (Symbol::cast(name)->name()->IsString()) {
+    str = String::cast(Symbol::cast(name)->name())
+              ->ToCString(DISALLOW_NULLS, ROBUST_STRING_TRAVERSAL);
+  }
+  const char* chars = str ? str.get() : "<symbol>";
+  // Callbacks only need to be found by their entry point, like in the text
+  // log, which gives them a size of one.
+  LogCodeCreate(reinterpret_cast<uint64_t>(entry_point), 1, prefix, chars,
+                StrLength(chars));
+}
+
+void BinaryProfLogger::CallbackEvent(Name* name, Address entry_point) {
+  CallbackEventInternal("Callback: ", name, entry_point);
+}
+
+void BinaryProfLogger::GetterCallbackEvent(Name* name, Address entry_point) {
+  CallbackEventInternal("Callback: get ", name, entry_point);
+}
+
+void BinaryProfLogger::SetterCallbackEvent(Name* name, Address entry_point) {
+  CallbackEventInternal("Callback: set ", name, entry_point);
+}
+
+void BinaryProfLogger::CodeMoveEvent(AbstractCode* from, Address to) {
+  CodeMoveStruct event;
+  event.from_address = reinterpret_cast<uint64_t>(from->instruction_start());
+  size_t header_size = from->instruction_start() - from->address();
+  event.to_address = reinterpret_cast<uint64_t>(to + header_size);
+  LogWriteStruct(event, NULL, 0);
+}
+
+void BinaryProfLogger::SharedLibraryEvent(const std::string& library_path,
+                                          uintptr_t start, uintptr_t end,
+                                          intptr_t aslr_slide) {
+  static const int kMaxNameSize =
+      kRecordBufferSize - 1 - static_cast<int>(sizeof(SharedLibraryStruct));
+  SharedLibraryStruct event;
+  event.start = start;
+  event.end = end;
+  event.aslr_slide = aslr_slide;
+  event.reserved = 0;
+  event.name_size =
+      Min(static_cast<int>(library_path.size()), kMaxNameSize);
+  LogWriteStruct(event, library_path.c_str(), event.name_size);
+}
+
+void BinaryProfLogger::TickEvent(v8::TickSample* sample, bool overflow,
+                                 int time_us) {
+  TickStruct event;
+  event.pc = reinterpret_cast<uint64_t>(sample->pc);
+  event.tos_or_external_callback =
+      sample->has_external_callback
+          ? reinterpret_cast<uint64_t>(sample->external_callback_entry)
+          : reinterpret_cast<uint64_t>(sample->tos);
+  event.time_us = static_cast<uint32_t>(time_us);
+  event.vm_state = static_cast<uint8_t>(sample->state);
+  event.has_external_callback = sample->has_external_callback ? 1 : 0;
+  event.overflow = overflow ? 1 : 0;
+  event.frames_count = static_cast<uint8_t>(sample->frames_count);
+  uint64_t frames[v8::TickSample::kMaxFramesCount];
+  for (unsigned i = 0; i < sample->frames_count; ++i) {
+    frames[i] = reinterpret_cast<uint64_t>(sample->stack[i]);
+  }
+  LogWriteStruct(event, reinterpret_cast<const char*>(frames),
+                 event.frames_count * static_cast<int>(sizeof(frames[0])));
+}
+
+
 class JitLogger : public CodeEventLogger {
  public:
   explicit JitLogger(JitCodeEventHandler code_event_handler);
@@ -747,6 +974,7 @@ Logger::Logger(Isolate* isolate)
       perf_basic_logger_(NULL),
       perf_jit_logger_(NULL),
       ll_logger_(NULL),
+      binary_prof_logger_(NULL),
       jit_logger_(NULL),
       listeners_(5),
       is_initialized_(false) {}
@@ -842,6 +1070,10 @@ void Logger::ApiSecurityCheck() {
 void Logger::SharedLibraryEvent(const std::string& library_path,
                                 uintptr_t start, uintptr_t end,
                                 intptr_t aslr_slide) {
+  if (binary_prof_logger_) {
+    binary_prof_logger_->SharedLibraryEvent(library_path, start, end,
+                                            aslr_slide);
+  }
   if (!log_->IsEnabled() || !FLAG_prof_cpp) return;
   Log::MessageBuilder msg(log_);
   msg.Append("shared-library,\"%s\",0x%08" V8PRIxPTR ",0x%08" V8PRIxPTR
@@ -1215,6 +1447,10 @@ void Logger::CodeMoveEvent(AbstractCode* from, Address to) {
   MoveEventInternal(CodeEventListener::CODE_MOVE_EVENT, from->address(), to);
 }
 
+void Logger::ClearDeadCodeEntries() {
+  if (perf_jit_logger_ != nullptr) perf_jit_logger_->ClearDeadCodeEntries();
+}
+
 void Logger::CodeLinePosInfoAddPositionEvent(void* jit_handler_data,
                                              int pc_offset, int position) {
   JIT_LOG(AddCodeLinePosInfoEvent(jit_handler_data,
@@ -1367,6 +1603,11 @@ void Logger::RuntimeCallTimerEvent() {
 }
 
 void Logger::TickEvent(v8::TickSample* sample, bool overflow) {
+  if (binary_prof_logger_) {
+    binary_prof_logger_->TickEvent(
+        sample, overflow, static_cast<int>(timer_.Elapsed().InMicroseconds()));
+    return;
+  }
   if (!log_->IsEnabled() || !FLAG_prof_cpp) return;
   if (FLAG_runtime_call_stats) {
     RuntimeCallTimerEvent();
@@ -1596,6 +1837,12 @@ void Logger::LogBytecodeHandlers() {
   }
 }
 
+bool Logger::IsFunctionTrampoline(AbstractCode* code,
+                                  SharedFunctionInfo* shared) {
+  return shared != nullptr && code->IsCode() &&
+         code->GetCode()->is_interpreter_trampoline_builtin();
+}
+
 void Logger::LogExistingFunction(Handle<SharedFunctionInfo> shared,
                                  Handle<AbstractCode> code) {
   Handle<String> func_name(shared->DebugName());
@@ -1662,6 +1909,15 @@ void Logger::LogCompiledFunctions() {
     if (code_objects[i].is_identical_to(isolate_->builtins()->CompileLazy()))
       continue;
     LogExistingFunction(sfis[i], code_objects[i]);
+    // Also log the function's own copy of the interpreter entry trampoline.
+    if (code_objects[i]->IsBytecodeArray()) {
+      Code* code = sfis[i]->code();
+      if (code->is_interpreter_trampoline_builtin() &&
+          code != *isolate_->builtins()->InterpreterEntryTrampoline()) {
+        LogExistingFunction(sfis[i],
+                            Handle<AbstractCode>(AbstractCode::cast(code)));
+      }
+    }
   }
 }
 
@@ -1769,6 +2025,11 @@ bool Logger::SetUp(Isolate* isolate) {
     addCodeEventListener(ll_logger_);
   }
 
+  if (FLAG_prof_binary) {
+    binary_prof_logger_ = new BinaryProfLogger(log_file_name.str().c_str());
+    addCodeEventListener(binary_prof_logger_);
+  }
+
   ticker_ = new Ticker(isolate, kSamplingIntervalMs);
 
   if (Log::InitLogAtStart()) {
@@ -1862,6 +2123,12 @@ FILE* Logger::TearDown() {
     ll_logger_ = NULL;
   }
 
+  if (binary_prof_logger_) {
+    removeCodeEventListener(binary_prof_logger_);
+    delete binary_prof_logger_;
+    binary_prof_logger_ = NULL;
+  }
+
   if (jit_logger_) {
     removeCodeEventListener(jit_logger_);
     delete jit_logger_;
@@ -65,6 +65,7 @@ class CpuProfiler;
 class Isolate;
 class JitLogger;
 class Log;
+class BinaryProfLogger;
 class LowLevelLogger;
 class PerfBasicLogger;
 class PerfJitLogger;
@@ -179,6 +180,9 @@ class Logger : public CodeEventListener {
   void RegExpCodeCreateEvent(AbstractCode* code, String* source);
   // Emits a code move event.
   void CodeMoveEvent(AbstractCode* from, Address to);
+  // Drops the records that loggers keep for code that did not survive
+  // marking. Called by the mark-compact collector.
+  void ClearDeadCodeEntries();
   // Emits a code line info add event with Postion type.
   void CodeLinePosInfoAddPositionEvent(void* jit_handler_data,
                                        int pc_offset,
@@ -261,6 +265,11 @@ class Logger : public CodeEventListener {
   INLINE(static CodeEventListener::LogEventsAndTags ToNativeByScript(
       CodeEventListener::LogEventsAndTags, Script*));
 
+  // Whether the code is an interpreted function's own copy of the interpreter
+  // entry trampoline (see --interpreted-frames-native-stack).
+  static bool IsFunctionTrampoline(AbstractCode* code,
+                                   SharedFunctionInfo* shared);
+
   // Profiler's sampling interval (in milliseconds).
 #if defined(ANDROID)
   // Phones and tablets have processors that are much slower than desktop
@@ -335,6 +344,7 @@ class Logger : public CodeEventListener {
   PerfBasicLogger* perf_basic_logger_;
   PerfJitLogger* perf_jit_logger_;
   LowLevelLogger* ll_logger_;
+  BinaryProfLogger* binary_prof_logger_;
   JitLogger* jit_logger_;
   std::unique_ptr<ProfilerListener> profiler_listener_;
   List<CodeEventListener*> listeners_;
@@ -561,7 +561,8 @@ class OneByteStringKey : public SequentialStringKey<uint8_t> {
       : SequentialStringKey<uint8_t>(str, seed) { }
 
   bool IsMatch(Object* string) override {
-    return String::cast(string)->IsOneByteEqualTo(string_);
+    return String::cast(string)->HashFieldMatches(hash_field_) &&
+           String::cast(string)->IsOneByteEqualTo(string_);
   }
 
   Handle<Object> AsHandle(Isolate* isolate) override;
@@ -607,7 +608,8 @@ class TwoByteStringKey : public SequentialStringKey<uc16> {
       : SequentialStringKey<uc16>(str, seed) { }
 
   bool IsMatch(Object* string) override {
-    return String::cast(string)->IsTwoByteEqualTo(string_);
+    return String::cast(string)->HashFieldMatches(hash_field_) &&
+           String::cast(string)->IsTwoByteEqualTo(string_);
   }
 
   Handle<Object> AsHandle(Isolate* isolate) override;
@@ -621,7 +623,8 @@ class Utf8StringKey : public HashTableKey {
       : string_(string), hash_field_(0), seed_(seed) { }
 
   bool IsMatch(Object* string) override {
-    return String::cast(string)->IsUtf8EqualTo(string_);
+    return String::cast(string)->HashFieldMatches(hash_field_) &&
+           String::cast(string)->IsUtf8EqualTo(string_);
   }
 
   uint32_t Hash() override {
@@ -3597,6 +3600,14 @@ bool String::Equals(String* other) {
 }
 
 
+// The string table only holds internalized strings, whose hashes are always
+// computed. Comparing them with the hash of a string key first rejects almost
+// all colliding entries without looking at their characters.
+bool String::HashFieldMatches(uint32_t hash_field) {
+  return Hash() == (hash_field >> kHashShift);
+}
+
+
 bool String::Equals(Handle<String> one, Handle<String> two) {
   if (one.is_identical_to(two)) return true;
   if (one->IsInternalizedString() && two->IsInternalizedString()) {
@@ -4106,6 +4117,14 @@ void BytecodeArray::set_osr_loop_nesting_level(int depth) {
   WRITE_INT_FIELD(this, kOSRNestingLevelOffset, depth);
 }
 
+int BytecodeArray::feedback_allocation_budget() const {
+  return READ_INT_FIELD(this, kFeedbackAllocationBudgetOffset);
+}
+
+void BytecodeArray::set_feedback_allocation_budget(int budget) {
+  WRITE_INT_FIELD(this, kFeedbackAllocationBudgetOffset, budget);
+}
+
 int BytecodeArray::parameter_count() const {
   // Parameter count is stored as the size on stack of the parameters to allow
   // it to be used directly by generated code.
@@ -4950,7 +4969,9 @@ inline bool Code::is_interpreter_trampoline_builtin() {
   Builtins* builtins = GetIsolate()->builtins();
   return this == *builtins->InterpreterEntryTrampoline() ||
          this == *builtins->InterpreterEnterBytecodeDispatch() ||
-         this == *builtins->InterpreterMarkBaselineOnReturn();
+         this == *builtins->InterpreterMarkBaselineOnReturn() ||
+         (FLAG_interpreted_frames_native_stack && kind() == BUILTIN &&
+          builtin_index() == Builtins::kInterpreterEntryTrampoline);
 }
 
 inline bool Code::has_unwinding_info() const {
@@ -6460,6 +6481,11 @@ TypeFeedbackVector* JSFunction::feedback_vector() {
   return array->feedback_vector();
 }
 
+bool JSFunction::feedback_vector_pending() {
+  return feedback_vector()->is_empty() &&
+         !shared()->feedback_metadata()->is_empty();
+}
+
 ACCESSORS(JSProxy, target, JSReceiver, kTargetOffset)
 ACCESSORS(JSProxy, handler, Object, kHandlerOffset)
 ACCESSORS(JSProxy, hash, Object, kHashOffset)
@@ -7647,6 +7673,11 @@ Handle<Object> NumberDictionaryShape::AsHandle(Isolate* isolate, uint32_t key) {
 
 
 bool NameDictionaryShape::IsMatch(Handle<Name> key, Object* other) {
+  // All entries are unique names, so a unique {key} can only match itself.
+  // Deciding that without loading the hash of {other} saves a cache miss per
+  // probed entry.
+  if (*key == other) return true;
+  if (key->IsUniqueName()) return false;
   // We know that all entries in a hash table had their hash keys created.
   // Use that knowledge to have fast failure.
   if (key->Hash() != Name::cast(other)->Hash()) return false;
@@ -10160,6 +10160,19 @@ Handle<LiteralsArray> LiteralsArray::New(Isolate* isolate,
   return casted_literals;
 }
 
+// static
+Handle<LiteralsArray> LiteralsArray::NewWithPendingFeedbackVector(
+    Isolate* isolate, int number_of_literals, PretenureFlag pretenure) {
+  // Unlike New, never share the empty literals array: the vector is installed
+  // into this array once it is allocated.
+  Handle<FixedArray> literals = isolate->factory()->NewFixedArray(
+      number_of_literals + kFirstLiteralIndex, pretenure);
+  Handle<LiteralsArray> casted_literals = Handle<LiteralsArray>::cast(literals);
+  casted_literals->set_feedback_vector(
+      TypeFeedbackVector::cast(isolate->heap()->empty_fixed_array()));
+  return casted_literals;
+}
+
 int HandlerTable::LookupRange(int pc_offset, int* data_out,
                               CatchPrediction* prediction_out) {
   int innermost_handler = -1;
@@ -11617,15 +11630,28 @@ Handle<LiteralsArray> SharedFunctionInfo::FindOrCreateLiterals(
   CodeAndLiterals result =
       shared->SearchOptimizedCodeMap(*native_context, BailoutId::None());
   if (result.literals != nullptr) {
-    DCHECK(shared->feedback_metadata()->is_empty() ||
-           !result.literals->feedback_vector()->is_empty());
-    return handle(result.literals, isolate);
+    Handle<LiteralsArray> literals(result.literals, isolate);
+    if (literals->feedback_vector()->is_empty() &&
+        !shared->feedback_metadata()->is_empty() &&
+        !shared->AllocatesFeedbackVectorLazily()) {
+      DCHECK(FLAG_lazy_feedback_allocation);
+      Handle<TypeFeedbackVector> feedback_vector =
+          TypeFeedbackVector::New(isolate, handle(shared->feedback_metadata()));
+      literals->set_feedback_vector(*feedback_vector);
+    }
+    return literals;
+  }
+
+  Handle<LiteralsArray> literals;
+  if (shared->AllocatesFeedbackVectorLazily()) {
+    literals = LiteralsArray::NewWithPendingFeedbackVector(
+        isolate, shared->num_literals(), TENURED);
+  } else {
+    Handle<TypeFeedbackVector> feedback_vector =
+        TypeFeedbackVector::New(isolate, handle(shared->feedback_metadata()));
+    literals = LiteralsArray::New(isolate, feedback_vector,
+                                  shared->num_literals(), TENURED);
   }
-
-  Handle<TypeFeedbackVector> feedback_vector =
-      TypeFeedbackVector::New(isolate, handle(shared->feedback_metadata()));
-  Handle<LiteralsArray> literals = LiteralsArray::New(
-      isolate, feedback_vector, shared->num_literals(), TENURED);
   Handle<Code> code;
   if (result.code != nullptr) {
     code = Handle<Code>(result.code, isolate);
@@ -11635,6 +11661,50 @@ Handle<LiteralsArray> SharedFunctionInfo::FindOrCreateLiterals(
   return literals;
 }
 
+bool SharedFunctionInfo::AllocatesFeedbackVectorLazily() {
+  // Only the interpreter copes with a missing feedback vector. The budget
+  // is shared by all closures, so once it is used up new literals arrays
+  // get their vector right away.
+  Isolate* isolate = GetIsolate();
+  return FLAG_lazy_feedback_allocation && !isolate->serializer_enabled() &&
+         HasBytecodeArray() && code()->is_interpreter_trampoline_builtin() &&
+         !feedback_metadata()->is_empty() &&
+         bytecode_array()->feedback_allocation_budget() > 0;
+}
+
+// static
+void SharedFunctionInfo::AllocatePendingFeedbackVectors(
+    Handle<SharedFunctionInfo> shared) {
+  if (!FLAG_lazy_feedback_allocation) return;
+  if (shared->feedback_metadata()->is_empty()) return;
+  if (shared->OptimizedCodeMapIsCleared()) return;
+  Isolate* isolate = shared->GetIsolate();
+
+  // Collect the pending literals arrays first, allocating the vectors may
+  // cause a GC that compacts the optimized code map.
+  List<Handle<LiteralsArray>> pending;
+  {
+    DisallowHeapAllocation no_gc;
+    FixedArray* code_map = shared->optimized_code_map();
+    for (int i = kEntriesStart; i < code_map->length(); i += kEntryLength) {
+      WeakCell* cell = WeakCell::cast(code_map->get(i + kLiteralsOffset));
+      if (cell->cleared()) continue;
+      LiteralsArray* literals = LiteralsArray::cast(cell->value());
+      if (literals->feedback_vector()->is_empty()) {
+        pending.Add(handle(literals, isolate));
+      }
+    }
+  }
+
+  Handle<TypeFeedbackMetadata> feedback_metadata(shared->feedback_metadata(),
+                                                 isolate);
+  for (Handle<LiteralsArray> const literals : pending) {
+    Handle<TypeFeedbackVector> feedback_vector =
+        TypeFeedbackVector::New(isolate, feedback_metadata);
+    literals->set_feedback_vector(*feedback_vector);
+  }
+}
+
 void SharedFunctionInfo::AddSharedCodeToOptimizedCodeMap(
     Handle<SharedFunctionInfo> shared, Handle<Code> code) {
   Isolate* isolate = shared->GetIsolate();
@@ -11842,6 +11912,18 @@ void JSFunction::EnsureLiterals(Handle<JSFunction> function) {
   }
 }
 
+// static
+void JSFunction::EnsureFeedbackVector(Handle<JSFunction> function) {
+  EnsureLiterals(function);
+  if (!function->feedback_vector_pending()) return;
+  Isolate* isolate = function->GetIsolate();
+  // The literals array is shared through the optimized code map, so this
+  // also installs the vector for other closures in the same native context.
+  Handle<TypeFeedbackVector> feedback_vector = TypeFeedbackVector::New(
+      isolate, handle(function->shared()->feedback_metadata(), isolate));
+  function->literals()->set_feedback_vector(*feedback_vector);
+}
+
 static void GetMinInobjectSlack(Map* map, void* data) {
   int slack = map->unused_property_fields();
   if (*reinterpret_cast<int*>(data) > slack) {
@@ -16070,6 +16152,7 @@ Handle<Object> SeqOneByteSubStringKey::AsHandle(Isolate* isolate) {
 
 
 bool SeqOneByteSubStringKey::IsMatch(Object* string) {
+  if (!String::cast(string)->HashFieldMatches(hash_field_)) return false;
   Vector<const uint8_t> chars(string_->GetChars() + from_, length_);
   return String::cast(string)->IsOneByteEqualTo(chars);
 }
@@ -4531,6 +4531,11 @@ class BytecodeArray : public FixedArrayBase {
   inline int osr_loop_nesting_level() const;
   inline void set_osr_loop_nesting_level(int depth);
 
+  // Accessors for the number of returns left before the feedback vector of
+  // the function is allocated (see --lazy-feedback-allocation).
+  inline int feedback_allocation_budget() const;
+  inline void set_feedback_allocation_budget(int budget);
+
   // Accessors for the constant pool.
   DECL_ACCESSORS(constant_pool, FixedArray)
 
@@ -4573,7 +4578,9 @@ class BytecodeArray : public FixedArrayBase {
   // TODO(4764): The OSR nesting level is guaranteed to be in [0;6] bounds and
   // could potentially be merged with another field (e.g. parameter_size).
   static const int kOSRNestingLevelOffset = kInterruptBudgetOffset + kIntSize;
-  static const int kHeaderSize = kOSRNestingLevelOffset + kIntSize;
+  static const int kFeedbackAllocationBudgetOffset =
+      kOSRNestingLevelOffset + kIntSize;
+  static const int kHeaderSize = kFeedbackAllocationBudgetOffset + kIntSize;
 
   // Maximal memory consumption for a single BytecodeArray.
   static const int kMaxSize = 512 * MB;
@@ -4861,6 +4868,11 @@ class LiteralsArray : public FixedArray {
                                    int number_of_literals,
                                    PretenureFlag pretenure);
 
+  // Creates a literals array whose feedback vector is allocated later, see
+  // JSFunction::EnsureFeedbackVector.
+  static Handle<LiteralsArray> NewWithPendingFeedbackVector(
+      Isolate* isolate, int number_of_literals, PretenureFlag pretenure);
+
   DECLARE_CAST(LiteralsArray)
 
  private:
@@ -6881,6 +6893,16 @@ class SharedFunctionInfo: public HeapObject {
   static Handle<LiteralsArray> FindOrCreateLiterals(
       Handle<SharedFunctionInfo> shared, Handle<Context> native_context);
 
+  // Returns true if new literals arrays of this function start out without a
+  // feedback vector (see --lazy-feedback-allocation).
+  bool AllocatesFeedbackVectorLazily();
+
+  // Allocates the feedback vectors still pending in the literals arrays of
+  // the optimized code map. Must be called before the function stops running
+  // in the interpreter.
+  static void AllocatePendingFeedbackVectors(
+      Handle<SharedFunctionInfo> shared);
+
   // Add or update entry in the optimized code map for context-independent code.
   static void AddSharedCodeToOptimizedCodeMap(Handle<SharedFunctionInfo> shared,
                                               Handle<Code> code);
@@ -7741,6 +7763,13 @@ class JSFunction: public JSObject {
   static void EnsureLiterals(Handle<JSFunction> function);
   inline TypeFeedbackVector* feedback_vector();
 
+  // Returns true if the function has feedback slots but its feedback vector
+  // has not been allocated yet (see --lazy-feedback-allocation).
+  inline bool feedback_vector_pending();
+
+  // Makes sure that the function has literals and a feedback vector.
+  static void EnsureFeedbackVector(Handle<JSFunction> function);
+
   // Unconditionally clear the type feedback vector (including vector ICs).
   void ClearTypeFeedbackInfo();
 
@@ -9056,6 +9085,9 @@ class String: public Name {
 
   // String equality operations.
   inline bool Equals(String* other);
+  // Compares the hash of this string, which must already be computed, with
+  // a hash field. Used to reject string table entries cheaply.
+  inline bool HashFieldMatches(uint32_t hash_field);
   inline static bool Equals(Handle<String> one, Handle<String> two);
   bool IsUtf8EqualTo(Vector<const char> str, bool allow_prefix_match = false);
   bool IsOneByteEqualTo(Vector<const uint8_t> str);
@@ -9185,6 +9217,47 @@ class String: public Name {
         NonAsciiStart(reinterpret_cast<const char*>(chars), length) >= length;
   }
 
+  // Returns the index of the first character that has to be escaped in a
+  // JSON string literal ('"', '\\' or a control character), or length if
+  // there is none.
+  static inline int JsonEscapeStart(const uint8_t* chars, int length) {
+    const uint8_t* start = chars;
+    const uint8_t* limit = chars + length;
+
+    if (length >= kIntptrSize) {
+      // Check unaligned bytes.
+      while (!IsAligned(reinterpret_cast<intptr_t>(chars), sizeof(uintptr_t))) {
+        if (IsJsonEscapeChar(*chars)) return static_cast<int>(chars - start);
+        ++chars;
+      }
+      // Check aligned words. (x - ones * n) & ~x & high_bits is non-zero iff
+      // some byte of x is below n, for n <= 0x80.
+      const uintptr_t ones = kUintptrAllBitsSet / 0xFF;
+      const uintptr_t high_bits = ones * 0x80;
+      while (chars + sizeof(uintptr_t) <= limit) {
+        uintptr_t word = *reinterpret_cast<const uintptr_t*>(chars);
+        uintptr_t quotes = word ^ (ones * '"');
+        uintptr_t backslashes = word ^ (ones * '\\');
+        if ((((word - ones * 0x20) & ~word) | ((quotes - ones) & ~quotes) |
+             ((backslashes - ones) & ~backslashes)) &
+            high_bits) {
+          break;
+        }
+        chars += sizeof(uintptr_t);
+      }
+    }
+    // Check remaining bytes.
+    while (chars < limit) {
+      if (IsJsonEscapeChar(*chars)) break;
+      ++chars;
+    }
+    return static_cast<int>(chars - start);
+  }
+
+  static inline bool IsJsonEscapeChar(uint8_t c) {
+    return c == '"' || c == '\\' || c < 0x20;
+  }
+
   static inline int NonOneByteStart(const uc16* chars, int length) {
     const uc16* limit = chars + length;
     const uc16* start = chars;
@@ -5382,8 +5382,15 @@ void Parser::HandleSourceURLComments(Isolate* isolate, Handle<Script> script) {
 
 
 void Parser::Internalize(Isolate* isolate, Handle<Script> script, bool error) {
-  // Internalize strings.
-  ast_value_factory()->Internalize(isolate);
+  // Internalize strings. This is the part of finalizing a background parse
+  // that has to run on the main thread, so account for it separately.
+  {
+    RuntimeCallTimerScope runtime_timer(isolate,
+                                        &RuntimeCallStats::ParseInternalize);
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.compile"),
+                 "V8.ParseInternalize");
+    ast_value_factory()->Internalize(isolate);
+  }
 
   // Error processing.
   if (error) {
@@ -31,6 +31,7 @@
 
 #include "src/assembler.h"
 #include "src/eh-frame.h"
+#include "src/heap/mark-compact.h"
 #include "src/objects-inl.h"
 #include "src/source-position-table.h"
 
@@ -82,6 +83,16 @@ struct PerfJitCodeLoad : PerfJitBase {
   uint64_t code_id_;
 };
 
+struct PerfJitCodeMove : PerfJitBase {
+  uint32_t process_id_;
+  uint32_t thread_id_;
+  uint64_t vma_;
+  uint64_t old_code_address_;
+  uint64_t new_code_address_;
+  uint64_t code_size_;
+  uint64_t code_id_;
+};
+
 struct PerfJitDebugEntry {
   uint64_t address_;
   int line_number_;
@@ -198,7 +209,8 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
   if (FLAG_perf_basic_prof_only_functions &&
       (abstract_code->kind() != AbstractCode::FUNCTION &&
        abstract_code->kind() != AbstractCode::INTERPRETED_FUNCTION &&
-       abstract_code->kind() != AbstractCode::OPTIMIZED_FUNCTION)) {
+       abstract_code->kind() != AbstractCode::OPTIMIZED_FUNCTION) &&
+      !Logger::IsFunctionTrampoline(abstract_code, shared)) {
     return;
   }
 
@@ -238,6 +250,10 @@ void PerfJitLogger::LogRecordedBuffer(AbstractCode* abstract_code,
   code_load.code_size_ = code_size;
   code_load.code_id_ = code_index_;
 
+  CodeLoadEntry& entry = code_load_map_[code->instruction_start()];
+  entry.code_index = code_index_;
+  entry.code_size = code_size;
+
   code_index_++;
 
   LogWriteBytes(reinterpret_cast<const char*>(&code_load), sizeof(code_load));
@@ -254,6 +270,7 @@ void PerfJitLogger::LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared) {
     entry_count++;
   }
   if (entry_count == 0) return;
+  if (!shared->script()->IsScript()) return;
   Handle<Script> script(Script::cast(shared->script()));
   Handle<Object> name_or_url(Script::GetNameOrSourceURL(script));
 
@@ -295,7 +312,10 @@ void PerfJitLogger::LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared) {
 
   int script_line_offset = script->line_offset();
   Handle<FixedArray> line_ends(FixedArray::cast(script->line_ends()));
-  Address code_start = code->instruction_start();
+  // "perf inject" places the code straight after the ELF header of the
+  // generated shared object, so positions have to be relative to that.
+  static const int kElfHeaderSize = 0x40;
+  Address code_start = code->instruction_start() + kElfHeaderSize;
 
   for (SourcePositionTableIterator iterator(code->source_position_table());
        !iterator.done(); iterator.Advance()) {
@@ -316,8 +336,10 @@ void PerfJitLogger::LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared) {
     PerfJitDebugEntry entry;
     entry.address_ =
         reinterpret_cast<uint64_t>(code_start + iterator.code_offset());
-    entry.line_number_ = line_number;
-    entry.column_ = column_offset;
+    // Script line numbers and columns are zero-based, perf expects them to
+    // start at one.
+    entry.line_number_ = line_number + 1;
+    entry.column_ = column_offset + 1;
     LogWriteBytes(reinterpret_cast<const char*>(&entry), sizeof(entry));
     LogWriteBytes(name_string.get(), name_length + 1);
   }
@@ -361,8 +383,53 @@ void PerfJitLogger::LogWriteUnwindingInfo(Code* code) {
 }
 
 void PerfJitLogger::CodeMoveEvent(AbstractCode* from, Address to) {
-  // Code relocation not supported.
-  UNREACHABLE();
+  // Bytecode arrays are never logged, so there is nothing to move.
+  if (!from->IsCode()) return;
+
+  // May be called concurrently from parallel evacuation tasks.
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  if (perf_output_handle_ == nullptr) return;
+
+  Address old_start = from->GetCode()->instruction_start();
+  CodeLoadMap::iterator it = code_load_map_.find(old_start);
+  if (it == code_load_map_.end()) return;
+  CodeLoadEntry entry = it->second;
+  code_load_map_.erase(it);
+
+  // The code object has not been copied yet, so its header cannot be read at
+  // the new location. The instruction start is at a fixed offset though.
+  Address new_start = to + Code::kHeaderSize;
+  code_load_map_[new_start] = entry;
+
+  PerfJitCodeMove code_move;
+  code_move.event_ = PerfJitCodeMove::kMove;
+  code_move.size_ = sizeof(code_move);
+  code_move.time_stamp_ = GetTimestamp();
+  code_move.process_id_ =
+      static_cast<uint32_t>(base::OS::GetCurrentProcessId());
+  code_move.thread_id_ = static_cast<uint32_t>(base::OS::GetCurrentThreadId());
+  code_move.vma_ = 0x0;  //  Our addresses are absolute.
+  code_move.old_code_address_ = reinterpret_cast<uint64_t>(old_start);
+  code_move.new_code_address_ = reinterpret_cast<uint64_t>(new_start);
+  code_move.code_size_ = entry.code_size;
+  code_move.code_id_ = entry.code_index;
+
+  LogWriteBytes(reinterpret_cast<const char*>(&code_move), sizeof(code_move));
+}
+
+void PerfJitLogger::ClearDeadCodeEntries() {
+  base::LockGuard<base::RecursiveMutex> guard_file(file_mutex_.Pointer());
+
+  for (CodeLoadMap::iterator it = code_load_map_.begin();
+       it != code_load_map_.end();) {
+    Code* code = Code::GetCodeFromTargetAddress(it->first);
+    if (Marking::IsBlackOrGrey(ObjectMarking::MarkBitFrom(code))) {
+      ++it;
+    } else {
+      it = code_load_map_.erase(it);
+    }
+  }
 }
 
 void PerfJitLogger::LogWriteBytes(const char* bytes, int size) {
@@ -28,6 +28,8 @@
 #ifndef V8_PERF_JIT_H_
 #define V8_PERF_JIT_H_
 
+#include <unordered_map>
+
 #include "src/log.h"
 
 namespace v8 {
@@ -45,6 +47,9 @@ class PerfJitLogger : public CodeEventLogger {
   void CodeDisableOptEvent(AbstractCode* code,
                            SharedFunctionInfo* shared) override {}
 
+  // Forgets code objects that were not marked by the current GC.
+  void ClearDeadCodeEntries();
+
  private:
   void OpenJitDumpFile();
   void CloseJitDumpFile();
@@ -68,6 +73,16 @@ class PerfJitLogger : public CodeEventLogger {
   void LogWriteDebugInfo(Code* code, SharedFunctionInfo* shared);
   void LogWriteUnwindingInfo(Code* code);
 
+  // Live code objects of this isolate logged so far, keyed by instruction
+  // start, so that code moves can refer back to the code index of the
+  // original load record.
+  struct CodeLoadEntry {
+    uint64_t code_index;
+    uint32_t code_size;
+  };
+  typedef std::unordered_map<Address, CodeLoadEntry> CodeLoadMap;
+  CodeLoadMap code_load_map_;
+
   static const uint32_t kElfMachIA32 = 3;
   static const uint32_t kElfMachX64 = 62;
   static const uint32_t kElfMachARM = 40;
@@ -109,6 +124,8 @@ class PerfJitLogger : public CodeEventLogger {
     UNIMPLEMENTED();
   }
 
+  void ClearDeadCodeEntries() { UNIMPLEMENTED(); }
+
   void CodeDisableOptEvent(AbstractCode* code,
                            SharedFunctionInfo* shared) override {
     UNIMPLEMENTED();
@@ -35,6 +35,9 @@ class HeapProfiler {
                                  v8::HeapProfiler::SamplingFlags);
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
+  SamplingHeapProfiler* sampling_heap_profiler() const {
+    return sampling_heap_profiler_.get();
+  }
   AllocationProfile* GetAllocationProfile();
 
   void StartHeapObjectsTracking(bool track_allocations);
@@ -12,11 +12,28 @@
 #include "src/frames-inl.h"
 #include "src/heap/heap.h"
 #include "src/isolate.h"
+#include "src/profiler/heap-profiler.h"
 #include "src/profiler/strings-storage.h"
 
 namespace v8 {
 namespace internal {
 
+namespace {
+
+const char* InstanceTypeName(InstanceType type) {
+  switch (type) {
+#define INSTANCE_TYPE_NAME(NAME) \
+  case NAME:                     \
+    return #NAME;
+    INSTANCE_TYPE_LIST(INSTANCE_TYPE_NAME)
+#undef INSTANCE_TYPE_NAME
+  }
+  UNREACHABLE();
+  return "UNKNOWN";
+}
+
+}  // namespace
+
 // We sample with a Poisson process, with constant average sampling interval.
 // This follows the exponential probability distribution with parameter
 // λ = 1/rate where rate is the average number of bytes between samples.
@@ -73,10 +90,12 @@ SamplingHeapProfiler::SamplingHeapProfiler(
       space->AddAllocationObserver(other_spaces_observer_.get());
     }
   }
+  heap->AddGCEpilogueCallback(OnGCEpilogue, kGCTypeAll, true);
 }
 
 
 SamplingHeapProfiler::~SamplingHeapProfiler() {
+  heap_->RemoveGCEpilogueCallback(OnGCEpilogue);
   heap_->new_space()->RemoveAllocationObserver(new_space_observer_.get());
   AllSpaces spaces(heap_);
   for (Space* space = spaces.next(); space != nullptr; space = spaces.next()) {
@@ -137,6 +156,81 @@ void SamplingHeapProfiler::OnWeakCallback(
   delete sample;
 }
 
+void SamplingHeapProfiler::OnGCEpilogue(v8::Isolate* isolate, GCType type,
+                                        GCCallbackFlags flags) {
+  SamplingHeapProfiler* profiler = reinterpret_cast<Isolate*>(isolate)
+                                       ->heap_profiler()
+                                       ->sampling_heap_profiler();
+  if (profiler != nullptr) profiler->UpdateSamplesAfterGC(type);
+}
+
+void SamplingHeapProfiler::UpdateSamplesAfterGC(GCType type) {
+  if (type != kGCTypeScavenge && type != kGCTypeMarkSweepCompact) return;
+  // Samples of objects that died during this GC have already been removed by
+  // OnWeakCallback, so everything left in samples_ survived it.
+  for (Sample* sample : samples_) {
+    RecordSampleType(sample);
+    if (type == kGCTypeScavenge) {
+      sample->scavenges_survived++;
+    } else {
+      sample->mark_compacts_survived++;
+    }
+  }
+}
+
+void SamplingHeapProfiler::RecordSampleType(Sample* sample) {
+  if (sample->type_recorded) return;
+  DisallowHeapAllocation no_allocation;
+  HandleScope scope(isolate_);
+  Local<v8::Value> local =
+      sample->global.Get(reinterpret_cast<v8::Isolate*>(isolate_));
+  Map* map = HeapObject::cast(*v8::Utils::OpenHandle(*local))->map();
+  sample->instance_type = map->instance_type();
+  if (map->IsJSObjectMap()) {
+    Object* constructor = map->GetConstructor();
+    if (constructor->IsJSFunction()) {
+      String* name = JSFunction::cast(constructor)->shared()->DebugName();
+      if (name->length() > 0) sample->constructor_name = names_->GetName(name);
+    }
+  }
+  sample->type_recorded = true;
+}
+
+bool SamplingHeapProfiler::AllocationNode::RetainedKey::operator<(
+    const RetainedKey& other) const {
+  if (instance_type != other.instance_type) {
+    return instance_type < other.instance_type;
+  }
+  // Constructor names are deduplicated by the StringsStorage, so comparing
+  // the pointers is enough.
+  if (constructor_name != other.constructor_name) {
+    return constructor_name < other.constructor_name;
+  }
+  if (size != other.size) return size < other.size;
+  if (scavenges_survived != other.scavenges_survived) {
+    return scavenges_survived < other.scavenges_survived;
+  }
+  return mark_compacts_survived < other.mark_compacts_survived;
+}
+
+void SamplingHeapProfiler::AllocationNode::ClearRetainedAllocations() {
+  retained_allocations_.clear();
+  for (auto child : children_) {
+    child.second->ClearRetainedAllocations();
+  }
+}
+
+void SamplingHeapProfiler::ComputeRetainedAllocations() {
+  profile_root_.ClearRetainedAllocations();
+  for (Sample* sample : samples_) {
+    RecordSampleType(sample);
+    AllocationNode::RetainedKey key = {
+        sample->instance_type, sample->constructor_name, sample->size,
+        sample->scavenges_survived, sample->mark_compacts_survived};
+    sample->owner->retained_allocations_[key]++;
+  }
+}
+
 SamplingHeapProfiler::AllocationNode*
 SamplingHeapProfiler::AllocationNode::FindOrAddChildNode(const char* name,
                                                          int script_id,
@@ -238,12 +332,31 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
   for (auto alloc : node->allocations_) {
     allocations.push_back(ScaleSample(alloc.first, alloc.second));
   }
+  // Copy the buckets first, translating the names allocates on the JS heap
+  // and may trigger a GC that changes the live samples.
+  std::vector<std::pair<AllocationNode::RetainedKey, unsigned int>> retained(
+      node->retained_allocations_.begin(), node->retained_allocations_.end());
+  std::vector<v8::AllocationProfile::RetainedAllocation> retained_allocations;
+  retained_allocations.reserve(retained.size());
+  for (auto entry : retained) {
+    const AllocationNode::RetainedKey& key = entry.first;
+    const char* constructor_name =
+        key.constructor_name != nullptr ? key.constructor_name : "";
+    retained_allocations.push_back(
+        {ToApiHandle<v8::String>(isolate_->factory()->InternalizeUtf8String(
+             InstanceTypeName(key.instance_type))),
+         ToApiHandle<v8::String>(
+             isolate_->factory()->InternalizeUtf8String(constructor_name)),
+         key.size, ScaleSample(key.size, entry.second).count,
+         key.scavenges_survived, key.mark_compacts_survived});
+  }
 
   profile->nodes().push_back(v8::AllocationProfile::Node(
       {ToApiHandle<v8::String>(
            isolate_->factory()->InternalizeUtf8String(node->name_)),
        script_name, node->script_id_, node->script_position_, line, column,
-       std::vector<v8::AllocationProfile::Node*>(), allocations}));
+       std::vector<v8::AllocationProfile::Node*>(), allocations,
+       retained_allocations}));
   v8::AllocationProfile::Node* current = &profile->nodes().back();
   // The children map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
@@ -271,6 +384,7 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
       scripts[script->id()] = handle(script);
     }
   }
+  ComputeRetainedAllocations();
   auto profile = new v8::internal::AllocationProfile();
   TranslateAllocationNode(profile, &profile_root_, scripts);
   return profile;
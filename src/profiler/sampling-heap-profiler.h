@@ -59,12 +59,24 @@ class SamplingHeapProfiler {
           owner(owner_),
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
-          profiler(profiler_) {}
+          profiler(profiler_),
+          type_recorded(false),
+          instance_type(FILLER_TYPE),
+          constructor_name(nullptr),
+          scavenges_survived(0),
+          mark_compacts_survived(0) {}
     ~Sample() { global.Reset(); }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
+    // The object is not initialized yet when it is sampled, so its type is
+    // recorded lazily at the first GC or profile request that sees it.
+    bool type_recorded;
+    InstanceType instance_type;
+    const char* constructor_name;
+    unsigned int scavenges_survived;
+    unsigned int mark_compacts_survived;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -104,9 +116,23 @@ class SamplingHeapProfiler {
     }
     AllocationNode* FindOrAddChildNode(const char* name, int script_id,
                                        int start_position);
+    void ClearRetainedAllocations();
+
+    // Live samples of this node bucketed by type and survival counts. Only
+    // valid while translating the node into an AllocationProfile::Node.
+    struct RetainedKey {
+      InstanceType instance_type;
+      const char* constructor_name;
+      size_t size;
+      unsigned int scavenges_survived;
+      unsigned int mark_compacts_survived;
+
+      bool operator<(const RetainedKey& other) const;
+    };
     // TODO(alph): make use of unordered_map's here. Pay attention to
     // iterator invalidation during TranslateAllocationNode.
     std::map<size_t, unsigned int> allocations_;
+    std::map<RetainedKey, unsigned int> retained_allocations_;
     std::map<FunctionId, AllocationNode*> children_;
     AllocationNode* const parent_;
     const int script_id_;
@@ -126,6 +152,13 @@ class SamplingHeapProfiler {
 
   static void OnWeakCallback(const WeakCallbackInfo<Sample>& data);
 
+  // Bumps the survival counts of all live samples after a scavenge or a
+  // mark-compact.
+  static void OnGCEpilogue(v8::Isolate* isolate, GCType type,
+                           GCCallbackFlags flags);
+  void UpdateSamplesAfterGC(GCType type);
+  void RecordSampleType(Sample* sample);
+
   // Methods that construct v8::AllocationProfile.
 
   // Translates the provided AllocationNode *node* returning an equivalent
@@ -138,6 +171,7 @@ class SamplingHeapProfiler {
       const std::map<int, Handle<Script>>& scripts);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count);
+  void ComputeRetainedAllocations();
   AllocationNode* AddStack();
 
   Isolate* const isolate_;
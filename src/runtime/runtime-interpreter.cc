@@ -171,5 +171,54 @@ RUNTIME_FUNCTION(Runtime_InterpreterSetPendingMessage) {
   return isolate->heap()->undefined_value();
 }
 
+RUNTIME_FUNCTION(Runtime_InterpreterAllocateFeedbackVector) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(1, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  JSFunction::EnsureFeedbackVector(function);
+  return isolate->heap()->undefined_value();
+}
+
+RUNTIME_FUNCTION(Runtime_InterpreterLoadGlobalWithoutFeedback) {
+  HandleScope scope(isolate);
+  DCHECK_EQ(3, args.length());
+  CONVERT_ARG_HANDLE_CHECKED(JSFunction, function, 0);
+  CONVERT_SMI_ARG_CHECKED(index, 1);
+  CONVERT_SMI_ARG_CHECKED(typeof_mode, 2);
+  DCHECK(function->feedback_vector_pending());
+
+  // Without a vector the name of the global has to come from the metadata.
+  FeedbackVectorSlot slot = TypeFeedbackVector::ToSlot(index);
+  Handle<String> name(function->shared()->feedback_metadata()->GetName(slot),
+                      isolate);
+  Handle<JSGlobalObject> global = isolate->global_object();
+
+  // Mirror LoadGlobalIC::Load without touching any feedback.
+  Handle<ScriptContextTable> script_contexts(
+      global->native_context()->script_context_table());
+  ScriptContextTable::LookupResult lookup_result;
+  if (ScriptContextTable::Lookup(script_contexts, name, &lookup_result)) {
+    Handle<Object> result =
+        FixedArray::get(*ScriptContextTable::GetContext(
+                            script_contexts, lookup_result.context_index),
+                        lookup_result.slot_index, isolate);
+    if (result->IsTheHole(isolate)) {
+      THROW_NEW_ERROR_RETURN_FAILURE(
+          isolate, NewReferenceError(MessageTemplate::kNotDefined, name));
+    }
+    return *result;
+  }
+
+  LookupIterator it(global, name);
+  Handle<Object> result;
+  ASSIGN_RETURN_FAILURE_ON_EXCEPTION(isolate, result, Object::GetProperty(&it));
+  if (!it.IsFound() &&
+      static_cast<TypeofMode>(typeof_mode) == NOT_INSIDE_TYPEOF) {
+    THROW_NEW_ERROR_RETURN_FAILURE(
+        isolate, NewReferenceError(MessageTemplate::kNotDefined, name));
+  }
+  return *result;
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -121,6 +121,7 @@ Object* DeclareGlobal(
 }
 
 Object* DeclareGlobals(Isolate* isolate, Handle<FixedArray> pairs, int flags,
+                       Handle<TypeFeedbackMetadata> feedback_metadata,
                        Handle<TypeFeedbackVector> feedback_vector) {
   HandleScope scope(isolate);
   Handle<JSGlobalObject> global(isolate->global_object());
@@ -130,7 +131,7 @@ Object* DeclareGlobals(Isolate* isolate, Handle<FixedArray> pairs, int flags,
   int length = pairs->length();
   FOR_WITH_HANDLE_SCOPE(isolate, int, i = 0, i, i < length, i += 2, {
     FeedbackVectorSlot slot(Smi::cast(pairs->get(i))->value());
-    Handle<String> name(feedback_vector->GetName(slot), isolate);
+    Handle<String> name(feedback_metadata->GetName(slot), isolate);
     Handle<Object> initial_value(pairs->get(i + 1), isolate);
 
     bool is_var = initial_value->IsUndefined(isolate);
@@ -180,7 +181,10 @@ RUNTIME_FUNCTION(Runtime_DeclareGlobals) {
   CONVERT_SMI_ARG_CHECKED(flags, 1);
   CONVERT_ARG_HANDLE_CHECKED(TypeFeedbackVector, feedback_vector, 2);
 
-  return DeclareGlobals(isolate, pairs, flags, feedback_vector);
+  Handle<TypeFeedbackMetadata> feedback_metadata(feedback_vector->metadata(),
+                                                 isolate);
+  return DeclareGlobals(isolate, pairs, flags, feedback_metadata,
+                        feedback_vector);
 }
 
 // TODO(ishell): merge this with Runtime::kDeclareGlobals once interpreter
@@ -193,9 +197,15 @@ RUNTIME_FUNCTION(Runtime_DeclareGlobalsForInterpreter) {
   CONVERT_SMI_ARG_CHECKED(flags, 1);
   CONVERT_ARG_HANDLE_CHECKED(JSFunction, closure, 2);
 
-  Handle<TypeFeedbackVector> feedback_vector(closure->feedback_vector(),
-                                             isolate);
-  return DeclareGlobals(isolate, pairs, flags, feedback_vector);
+  Handle<TypeFeedbackMetadata> feedback_metadata(
+      closure->shared()->feedback_metadata(), isolate);
+  // Skip preinitializing the global load slots while the vector is pending.
+  Handle<TypeFeedbackVector> feedback_vector;
+  if (!closure->feedback_vector_pending()) {
+    feedback_vector = handle(closure->feedback_vector(), isolate);
+  }
+  return DeclareGlobals(isolate, pairs, flags, feedback_metadata,
+                        feedback_vector);
 }
 
 RUNTIME_FUNCTION(Runtime_InitializeVarGlobal) {
@@ -205,12 +205,14 @@ namespace internal {
   F(ForInNext, 4, 1)                \
   F(ForInStep, 1, 1)
 
-#define FOR_EACH_INTRINSIC_INTERPRETER(F) \
-  F(InterpreterNewClosure, 2, 1)          \
-  F(InterpreterTraceBytecodeEntry, 3, 1)  \
-  F(InterpreterTraceBytecodeExit, 3, 1)   \
-  F(InterpreterClearPendingMessage, 0, 1) \
-  F(InterpreterSetPendingMessage, 1, 1)
+#define FOR_EACH_INTRINSIC_INTERPRETER(F)       \
+  F(InterpreterNewClosure, 2, 1)                \
+  F(InterpreterTraceBytecodeEntry, 3, 1)        \
+  F(InterpreterTraceBytecodeExit, 3, 1)         \
+  F(InterpreterClearPendingMessage, 0, 1)       \
+  F(InterpreterSetPendingMessage, 1, 1)         \
+  F(InterpreterAllocateFeedbackVector, 1, 1)    \
+  F(InterpreterLoadGlobalWithoutFeedback, 3, 1)
 
 #define FOR_EACH_INTRINSIC_FUNCTION(F)     \
   F(FunctionGetName, 1, 1)                 \
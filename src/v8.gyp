@@ -552,6 +552,8 @@
         'compiler/ast-loop-assignment-analyzer.h',
         'compiler/basic-block-instrumentor.cc',
         'compiler/basic-block-instrumentor.h',
+        'compiler/bounds-check-elimination.cc',
+        'compiler/bounds-check-elimination.h',
         'compiler/branch-elimination.cc',
         'compiler/branch-elimination.h',
         'compiler/bytecode-branch-analysis.cc',
@@ -655,10 +657,14 @@
         'compiler/load-elimination.h',
         'compiler/loop-analysis.cc',
         'compiler/loop-analysis.h',
+        'compiler/loop-invariant-code-motion.cc',
+        'compiler/loop-invariant-code-motion.h',
         'compiler/loop-peeling.cc',
         'compiler/loop-peeling.h',
         'compiler/loop-variable-optimizer.cc',
         'compiler/loop-variable-optimizer.h',
+        'compiler/loop-vectorizer.cc',
+        'compiler/loop-vectorizer.h',
         'compiler/machine-operator-reducer.cc',
         'compiler/machine-operator-reducer.h',
         'compiler/machine-operator.cc',
@@ -953,6 +959,7 @@
         'ic/call-optimization.h',
         'ic/handler-compiler.cc',
         'ic/handler-compiler.h',
+        'ic/handler-configuration.h',
         'ic/ic-inl.h',
         'ic/ic-state.cc',
         'ic/ic-state.h',
@@ -1101,6 +1101,7 @@ class Assembler : public AssemblerBase {
   void psrlq(XMMRegister reg, byte imm8);
   void pslld(XMMRegister reg, byte imm8);
   void psrld(XMMRegister reg, byte imm8);
+  void psrad(XMMRegister reg, byte imm8);
 
   void cvttsd2si(Register dst, const Operand& src);
   void cvttsd2si(Register dst, XMMRegister src);
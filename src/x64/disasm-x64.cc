@@ -1644,8 +1644,10 @@ int DisassemblerX64::TwoByteOpcodeInstruction(byte* data) {
         current += 1;
       } else if (opcode == 0x72) {
         current += 1;
-        AppendToBuffer("%s %s,%d", (regop == 6) ? "pslld" : "psrld",
-                       NameOfXMMRegister(rm), *current & 0x7f);
+        const char* mnemonic =
+            (regop == 6) ? "pslld" : (regop == 4) ? "psrad" : "psrld";
+        AppendToBuffer("%s %s,%d", mnemonic, NameOfXMMRegister(rm),
+                       *current & 0x7f);
         current += 1;
       } else if (opcode == 0x73) {
         current += 1;
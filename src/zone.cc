@@ -6,6 +6,7 @@
 
 #include <cstring>
 
+#include "src/base/bits.h"
 #include "src/v8.h"
 
 #ifdef V8_USE_ADDRESS_SANITIZER
@@ -203,7 +204,7 @@ void Zone::DeleteKeptSegment() {
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(size_t size) {
-  Segment* result = reinterpret_cast<Segment*>(allocator_->Allocate(size));
+  Segment* result = reinterpret_cast<Segment*>(allocator_->GetSegment(size));
   segment_bytes_allocated_ += size;
   if (result != nullptr) {
     result->Initialize(segment_head_, size);
@@ -216,7 +217,11 @@ Segment* Zone::NewSegment(size_t size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, size_t size) {
   segment_bytes_allocated_ -= size;
-  allocator_->Free(segment, size);
+  // Hand the segment back without this zone's red zones. If the allocator
+  // keeps it in its segment pool, it poisons the segment until it is handed
+  // out again.
+  ASAN_UNPOISON_MEMORY_REGION(segment, size);
+  allocator_->ReturnSegment(segment, size);
 }
 
 
@@ -230,20 +235,19 @@ Address Zone::NewExpand(size_t size) {
              size);
 
   // Compute the new segment size. We use a 'high water mark'
-  // strategy, where we increase the segment size every time we expand
+  // strategy, where we double the segment size every time we expand
   // except that we employ a maximum segment size when we delete. This
   // is to avoid excessive malloc() and free() overhead.
   Segment* head = segment_head_;
   const size_t old_size = (head == nullptr) ? 0 : head->size();
   static const size_t kSegmentOverhead = sizeof(Segment) + kAlignment;
-  const size_t new_size_no_overhead = size + (old_size << 1);
-  size_t new_size = kSegmentOverhead + new_size_no_overhead;
   const size_t min_new_size = kSegmentOverhead + size;
   // Guard against integer overflow.
-  if (new_size_no_overhead < size || new_size < kSegmentOverhead) {
+  if (min_new_size < size) {
     V8::FatalProcessOutOfMemory("Zone");
     return nullptr;
   }
+  size_t new_size = Max(min_new_size, old_size << 1);
   if (new_size < kMinimumSegmentSize) {
     new_size = kMinimumSegmentSize;
   } else if (new_size > kMaximumSegmentSize) {
@@ -252,6 +256,11 @@ Address Zone::NewExpand(size_t size) {
     // All the while making sure to allocate a segment large enough to hold the
     // requested size.
     new_size = Max(min_new_size, kMaximumSegmentSize);
+  } else {
+    // Use power of two sizes, so that the allocator can recycle the segment
+    // for other zones through its segment pool.
+    new_size =
+        base::bits::RoundUpToPowerOfTwo32(static_cast<uint32_t>(new_size));
   }
   if (new_size > INT_MAX) {
     V8::FatalProcessOutOfMemory("Zone");
@@ -639,6 +639,61 @@ TEST(InterpreterLoadNamedProperty) {
 }
 
 
+TEST(InterpreterLoadNamedPropertyMonomorphicField) {
+  HandleAndZoneScope handles;
+  i::Isolate* isolate = handles.main_isolate();
+  i::Factory* factory = isolate->factory();
+  i::Zone zone(isolate->allocator());
+
+  std::pair<const char*, Handle<Object>> objects[] = {
+      // In-object field.
+      std::make_pair("({ val : 123 })", handle(Smi::FromInt(123), isolate)),
+      // Out-of-object field.
+      std::make_pair("(function() {"
+                     "  var o = {};"
+                     "  o.a = 1; o.b = 2; o.c = 3; o.d = 4; o.e = 5;"
+                     "  o.val = 123;"
+                     "  return o;"
+                     "})()",
+                     handle(Smi::FromInt(123), isolate)),
+      // Double field, which is not handled inline.
+      std::make_pair("({ val : 1.5 })", factory->NewNumber(1.5)),
+  };
+
+  Handle<i::String> name = factory->NewStringFromAsciiChecked("val");
+  name = factory->string_table()->LookupString(isolate, name);
+
+  for (size_t i = 0; i < arraysize(objects); i++) {
+    i::FeedbackVectorSpec feedback_spec(&zone);
+    i::FeedbackVectorSlot slot = feedback_spec.AddLoadICSlot();
+    Handle<i::TypeFeedbackVector> vector =
+        i::NewTypeFeedbackVector(isolate, &feedback_spec);
+
+    BytecodeArrayBuilder builder(handles.main_isolate(), handles.main_zone(),
+                                 1, 0, 0);
+    builder.LoadNamedProperty(builder.Parameter(0), name,
+                              vector->GetIndex(slot))
+        .Return();
+    Handle<BytecodeArray> bytecode_array = builder.ToBytecodeArray();
+
+    InterpreterTester tester(handles.main_isolate(), bytecode_array, vector);
+    auto callable = tester.GetCallable<Handle<Object>>();
+
+    Handle<Object> object = InterpreterTester::NewObject(objects[i].first);
+    // The first call misses, later calls hit the monomorphic feedback.
+    for (int j = 0; j < 3; j++) {
+      Handle<Object> return_val = callable(object).ToHandleChecked();
+      CHECK(return_val->SameValue(*objects[i].second));
+    }
+
+    // A receiver with a different map must not take the inline path.
+    Handle<Object> other =
+        InterpreterTester::NewObject("({ other : 0, val : 456 })");
+    Handle<Object> return_val = callable(other).ToHandleChecked();
+    CHECK_EQ(Smi::cast(*return_val), Smi::FromInt(456));
+  }
+}
+
 TEST(InterpreterLoadKeyedProperty) {
   HandleAndZoneScope handles;
   i::Isolate* isolate = handles.main_isolate();
@@ -1709,6 +1764,41 @@ TEST(InterpreterArrayLiterals) {
 }
 
 
+TEST(InterpreterArrayLiteralsAreFreshCopies) {
+  HandleAndZoneScope handles;
+  i::Isolate* isolate = handles.main_isolate();
+  i::Factory* factory = isolate->factory();
+
+  // Each literal is evaluated several times so later evaluations clone the
+  // boilerplate from the allocation site. Mutating the result must not leak
+  // into the boilerplate, including copy-on-write elements.
+  std::pair<const char*, Handle<Object>> literals[] = {
+      std::make_pair("var a = []; a.push(1); return a.length;\n",
+                     handle(Smi::FromInt(1), isolate)),
+      std::make_pair(
+          "var a = [1, 2, 3]; a[0] += 10; return a[0] + a.length;\n",
+          handle(Smi::FromInt(14), isolate)),
+      std::make_pair("var a = ['a', 'b']; a[1] = 'c'; return a[0] + a[1];\n",
+                     factory->NewStringFromStaticChars("ac")),
+      std::make_pair("var a = [1.5, 2.5]; a[1] = 7; return a[0] + a[1];\n",
+                     factory->NewNumber(8.5)),
+      std::make_pair(
+          "var x = 2; var a = [x, x]; a[0]++; return a[0] + a[1];\n",
+          handle(Smi::FromInt(5), isolate)),
+  };
+
+  for (size_t i = 0; i < arraysize(literals); i++) {
+    std::string source(InterpreterTester::SourceForBody(literals[i].first));
+    InterpreterTester tester(handles.main_isolate(), source.c_str());
+    auto callable = tester.GetCallable<>();
+
+    for (int j = 0; j < 3; j++) {
+      Handle<i::Object> return_value = callable().ToHandleChecked();
+      CHECK(return_value->SameValue(*literals[i].second));
+    }
+  }
+}
+
 TEST(InterpreterObjectLiterals) {
   HandleAndZoneScope handles;
   i::Isolate* isolate = handles.main_isolate();
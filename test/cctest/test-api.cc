@@ -25460,3 +25460,40 @@ TEST(EvalInAccessCheckedContext) {
   CHECK_EQ(42, x_value->Int32Value(context1).FromJust());
   context1->Exit();
 }
+
+static int64_t RuntimeStatisticsCount(
+    const std::vector<v8::RuntimeStatistics::Entry>& entries,
+    const char* name) {
+  for (const v8::RuntimeStatistics::Entry& entry : entries) {
+    if (strcmp(entry.name, name) == 0) return entry.count;
+  }
+  return 0;
+}
+
+TEST(GetRuntimeStatistics) {
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+
+  isolate->ResetRuntimeStatistics();
+  v8::RuntimeStatistics statistics;
+  isolate->GetRuntimeStatistics(&statistics);
+  CHECK_EQ(0, RuntimeStatisticsCount(statistics.ic_misses(), "LOAD_IC"));
+
+  CompileRun(
+      "function load(o) { return o.x; }"
+      "for (var i = 0; i < 10; i++) load({x: i, y: i});");
+  isolate->GetRuntimeStatistics(&statistics);
+  CHECK_LT(0, RuntimeStatisticsCount(statistics.ic_misses(), "LOAD_IC"));
+  int64_t compiles = 0;
+  for (const v8::RuntimeStatistics::Entry& entry : statistics.compiles()) {
+    compiles += entry.count;
+  }
+  CHECK_LT(0, compiles);
+
+  isolate->ResetRuntimeStatistics();
+  isolate->GetRuntimeStatistics(&statistics);
+  CHECK(statistics.ic_misses().empty());
+  CHECK(statistics.deopts().empty());
+  CHECK(statistics.compiles().empty());
+}
@@ -32,10 +32,13 @@
 #include "include/v8-profiler.h"
 #include "src/base/platform/platform.h"
 #include "src/deoptimizer.h"
+#include "src/frames-inl.h"
+#include "src/interpreter/interpreter.h"
 #include "src/profiler/cpu-profiler-inl.h"
 #include "src/profiler/profiler-listener.h"
 #include "src/utils.h"
 #include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
 #include "test/cctest/profiler-extension.h"
 
 using i::CodeEntry;
@@ -1499,6 +1502,102 @@ TEST(CollectSampleAPI) {
   profile->Delete();
 }
 
+static const char* interpreted_frames_native_stack_test_source =
+    "function interpretedFunction() {\n"
+    "  CollectStackSample();\n"
+    "}";
+
+static void* collected_frames[v8::TickSample::kMaxFramesCount];
+static size_t collected_frames_count = 0;
+
+static void CollectStackSample(
+    const v8::FunctionCallbackInfo<v8::Value>& info) {
+  // Sample the stack below this callback the way the profiler does.
+  i::StackFrameIterator it(reinterpret_cast<i::Isolate*>(info.GetIsolate()));
+  v8::RegisterState regs;
+  regs.sp = it.frame()->sp();
+  regs.fp = it.frame()->fp();
+  regs.pc = it.frame()->pc();
+  v8::SampleInfo sample_info;
+  CHECK(v8::TickSample::GetStackSample(
+      info.GetIsolate(), regs, v8::TickSample::kSkipCEntryFrame,
+      collected_frames, arraysize(collected_frames), &sample_info));
+  collected_frames_count = sample_info.frames_count;
+}
+
+// Checks that the last sample reported the frame of |function| as an
+// interpreted frame, i.e. by its bytecode array rather than by a pc within
+// its copy of the entry trampoline.
+static void CheckInterpretedFrameSampled(i::Handle<i::JSFunction> function) {
+  i::BytecodeArray* bytecode_array = function->shared()->bytecode_array();
+  i::Address bytecode_start = bytecode_array->address();
+  i::Address bytecode_end = bytecode_start + bytecode_array->Size();
+  i::Code* code = function->code();
+  bool found_bytecode = false;
+  for (size_t i = 0; i < collected_frames_count; i++) {
+    i::Address pc = reinterpret_cast<i::Address>(collected_frames[i]);
+    CHECK(pc < code->instruction_start() || pc >= code->instruction_end());
+    if (pc >= bytecode_start && pc < bytecode_end) found_bytecode = true;
+  }
+  CHECK(found_bytecode);
+}
+
+TEST(InterpretedFramesNativeStack) {
+  bool saved_ignition = i::FLAG_ignition;
+  bool saved_native_stack = i::FLAG_interpreted_frames_native_stack;
+  bool saved_manual_evacuation =
+      i::FLAG_manual_evacuation_candidates_selection;
+  i::FLAG_ignition = true;
+  i::FLAG_interpreted_frames_native_stack = true;
+  i::FLAG_manual_evacuation_candidates_selection = true;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> env = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(env);
+
+    v8::Local<v8::Function> func =
+        v8::FunctionTemplate::New(isolate, CollectStackSample)
+            ->GetFunction(env)
+            .ToLocalChecked();
+    env->Global()->Set(env, v8_str("CollectStackSample"), func).FromJust();
+
+    // Make sure the function's code ends up on a fresh page, which can be
+    // evacuated unlike the pages filled during deserialization.
+    i::heap::SimulateFullSpace(i_isolate->heap()->code_space());
+    CompileRun(interpreted_frames_native_stack_test_source);
+    CompileRun("interpretedFunction();");
+    i::Handle<i::JSFunction> function = i::Handle<i::JSFunction>::cast(
+        v8::Utils::OpenHandle(*GetFunction(env, "interpretedFunction")));
+    CHECK(function->shared()->HasBytecodeArray());
+    CHECK(function->code() !=
+          *i_isolate->builtins()->InterpreterEntryTrampoline());
+    CheckInterpretedFrameSampled(function);
+
+    // The frame is still recognized after the copy has been moved.
+    i::Address old_start = function->code()->instruction_start();
+    i::Page::FromAddress(function->code()->address())
+        ->SetFlag(i::MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+    i_isolate->heap()->CollectAllGarbage();
+    CHECK(function->code()->instruction_start() != old_start);
+    CHECK(!i_isolate->interpreter()->IsTrampolineCopyPc(old_start));
+    CHECK(i_isolate->interpreter()->IsTrampolineCopyPc(
+        function->code()->instruction_start()));
+    CompileRun("interpretedFunction();");
+    CheckInterpretedFrameSampled(function);
+  }
+  isolate->Dispose();
+
+  i::FLAG_ignition = saved_ignition;
+  i::FLAG_interpreted_frames_native_stack = saved_native_stack;
+  i::FLAG_manual_evacuation_candidates_selection = saved_manual_evacuation;
+}
+
 static const char* js_native_js_runtime_multiple_test_source =
     "%NeverOptimizeFunction(foo);\n"
     "%NeverOptimizeFunction(bar);\n"
@@ -459,6 +459,7 @@ TEST(DisasmX64) {
 
     __ pslld(xmm0, 6);
     __ psrld(xmm0, 6);
+    __ psrad(xmm0, 6);
     __ psllq(xmm0, 6);
     __ psrlq(xmm0, 6);
 
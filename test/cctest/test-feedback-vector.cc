@@ -353,6 +353,44 @@ TEST(VectorLoadICStates) {
 }
 
 
+TEST(VectorLoadICHighPolymorphism) {
+  if (i::FLAG_always_opt) return;
+  const int kMaxMaps = 12;
+  i::FLAG_max_polymorphic_map_count = kMaxMaps;
+  CcTest::InitializeVM();
+  LocalContext context;
+  v8::HandleScope scope(context->GetIsolate());
+  Isolate* isolate = CcTest::i_isolate();
+
+  CompileRun(
+      "function make(i) { var o = {}; o['p' + i] = i; o.foo = i; return o; }"
+      "function f(a) { return a.foo; }");
+  Handle<JSFunction> f = GetFunction("f");
+  Handle<TypeFeedbackVector> feedback_vector =
+      Handle<TypeFeedbackVector>(f->feedback_vector(), isolate);
+  LoadICNexus nexus(feedback_vector, FeedbackVectorSlot(0));
+
+  // The first call only primes the IC.
+  CompileRun("f(make(0)); f(make(0));");
+  CHECK_EQ(MONOMORPHIC, nexus.StateFromFeedback());
+
+  // Stay polymorphic up to the configured number of maps.
+  CompileRun("for (var i = 1; i < 12; i++) f(make(i));");
+  CHECK_EQ(POLYMORPHIC, nexus.StateFromFeedback());
+  MapHandleList maps;
+  nexus.FindAllMaps(&maps);
+  CHECK_EQ(kMaxMaps, maps.length());
+
+  // Already seen maps are handled by the polymorphic IC.
+  CompileRun("for (var i = 0; i < 12; i++) f(make(i));");
+  CHECK_EQ(POLYMORPHIC, nexus.StateFromFeedback());
+
+  // One more map drives the IC megamorphic.
+  CompileRun("f(make(12));");
+  CHECK_EQ(MEGAMORPHIC, nexus.StateFromFeedback());
+}
+
+
 TEST(VectorLoadICSlotSharing) {
   if (i::FLAG_always_opt) return;
   CcTest::InitializeVM();
@@ -3057,3 +3057,55 @@ TEST(SamplingHeapProfilerLeftTrimming) {
 
   heap_profiler->StopSamplingHeapProfiler();
 }
+
+TEST(SamplingHeapProfilerRetainedAllocations) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Turn off always_opt. Inlining can cause stack traces to be shorter than
+  // what we expect in this test.
+  v8::internal::FLAG_always_opt = false;
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(256);
+
+  CompileRun(
+      "function Leak() { this.a = 1; this.b = 2; this.c = 3; }\n"
+      "var leaked = [];\n"
+      "function leak() {\n"
+      "  for (var i = 0; i < 1024; ++i) leaked.push(new Leak());\n"
+      "}\n"
+      "leak();\n");
+
+  CcTest::heap()->CollectGarbage(v8::internal::NEW_SPACE);
+  CcTest::heap()->CollectAllGarbage();
+
+  std::unique_ptr<v8::AllocationProfile> profile(
+      heap_profiler->GetAllocationProfile());
+  CHECK(profile);
+  const char* names[] = {"", "leak"};
+  auto node = FindAllocationProfileNode(*profile, ArrayVector(names));
+  CHECK(node);
+
+  // Everything still alive survived at least the two GCs above.
+  size_t surviving = v8::AllocationProfile::GetSurvivingSize(node, 2);
+  CHECK_GT(surviving, 0u);
+  CHECK_EQ(surviving, v8::AllocationProfile::GetSurvivingSize(node, 0));
+
+  bool found_leak = false;
+  for (auto allocation : node->retained_allocations) {
+    CHECK_GE(allocation.mark_compacts_survived, 1u);
+    v8::String::Utf8Value constructor_name(allocation.constructor_name);
+    if (strcmp(*constructor_name, "Leak") == 0) {
+      v8::String::Utf8Value instance_type(allocation.instance_type);
+      CHECK_EQ(0, strcmp(*instance_type, "JS_OBJECT_TYPE"));
+      found_leak = true;
+    }
+  }
+  CHECK(found_leak);
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
@@ -34,6 +34,8 @@
 #include <cmath>
 #endif  // __linux__
 
+#include <map>
+
 #include "src/v8.h"
 
 #include "src/log.h"
@@ -45,6 +47,7 @@
 #include "src/version.h"
 #include "src/vm-state-inl.h"
 #include "test/cctest/cctest.h"
+#include "test/cctest/heap/heap-utils.h"
 
 using v8::internal::Address;
 using v8::internal::EmbeddedVector;
@@ -615,3 +618,255 @@ TEST(Issue539892) {
   }
   isolate->Dispose();
 }
+
+
+#if V8_OS_LINUX
+namespace {
+
+// Mirrors the record layout written by src/perf-jit.cc.
+struct PerfJitDumpHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint32_t size;
+  uint32_t elf_mach_target;
+  uint32_t reserved;
+  uint32_t process_id;
+  uint64_t time_stamp;
+  uint64_t flags;
+};
+
+struct PerfJitDumpRecord {
+  uint32_t event;
+  uint32_t size;
+  uint64_t time_stamp;
+};
+
+struct PerfJitDumpCodeLoad : PerfJitDumpRecord {
+  uint32_t process_id;
+  uint32_t thread_id;
+  uint64_t vma;
+  uint64_t code_address;
+  uint64_t code_size;
+  uint64_t code_id;
+};
+
+struct PerfJitDumpCodeMove : PerfJitDumpRecord {
+  uint32_t process_id;
+  uint32_t thread_id;
+  uint64_t vma;
+  uint64_t old_code_address;
+  uint64_t new_code_address;
+  uint64_t code_size;
+  uint64_t code_id;
+};
+
+}  // namespace
+
+
+TEST(PerfJitDump) {
+  bool saved_perf_prof = i::FLAG_perf_prof;
+  bool saved_native_stack = i::FLAG_interpreted_frames_native_stack;
+  bool saved_ignition = i::FLAG_ignition;
+  bool saved_manual_evacuation =
+      i::FLAG_manual_evacuation_candidates_selection;
+  i::FLAG_perf_prof = true;
+  i::FLAG_interpreted_frames_native_stack = true;
+  i::FLAG_ignition = true;
+  i::FLAG_manual_evacuation_candidates_selection = true;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  i::Isolate* i_isolate = reinterpret_cast<i::Isolate*>(isolate);
+  uint64_t code_before_gc;
+  uint64_t code_after_gc;
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> env = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(env);
+
+    // Make sure the function's code ends up on a fresh page, which can be
+    // evacuated unlike the pages filled during deserialization.
+    i::heap::SimulateFullSpace(i_isolate->heap()->code_space());
+    CompileRun(
+        "function perfJitTestFunction(a) { return a + 1; }"
+        "perfJitTestFunction(1);");
+    i::Handle<i::JSFunction> fun = i::Handle<i::JSFunction>::cast(
+        v8::Utils::OpenHandle(*v8::Local<v8::Function>::Cast(
+            env->Global()
+                ->Get(env, v8_str("perfJitTestFunction"))
+                .ToLocalChecked())));
+    if (fun->shared()->HasBytecodeArray()) {
+      // The function runs on its own copy of the entry trampoline.
+      CHECK(fun->code()->is_interpreter_trampoline_builtin());
+      CHECK(fun->code() !=
+            *i_isolate->builtins()->InterpreterEntryTrampoline());
+    }
+
+    // Force the function's code to move, which has to be reflected by a
+    // code move record.
+    code_before_gc =
+        reinterpret_cast<uint64_t>(fun->code()->instruction_start());
+    i::Page::FromAddress(fun->code()->address())
+        ->SetFlag(i::MemoryChunk::FORCE_EVACUATION_CANDIDATE_FOR_TESTING);
+    i_isolate->heap()->CollectAllGarbage();
+    code_after_gc =
+        reinterpret_cast<uint64_t>(fun->code()->instruction_start());
+  }
+  // Disposing the last isolate closes the dump file.
+  isolate->Dispose();
+
+  i::EmbeddedVector<char, 32> filename;
+  i::SNPrintF(filename, "./jit-%d.dump", v8::base::OS::GetCurrentProcessId());
+  bool exists = false;
+  i::Vector<const char> dump(i::ReadFile(filename.start(), &exists, true));
+  CHECK(exists);
+  unlink(filename.start());
+
+  size_t length = static_cast<size_t>(dump.length());
+  const char* data = dump.start();
+  CHECK_LE(sizeof(PerfJitDumpHeader), length);
+  const PerfJitDumpHeader* header =
+      reinterpret_cast<const PerfJitDumpHeader*>(data);
+  CHECK_EQ(0x4A695444u, header->magic);
+  CHECK_EQ(1u, header->version);
+  CHECK_EQ(sizeof(PerfJitDumpHeader), header->size);
+  CHECK_EQ(static_cast<uint32_t>(v8::base::OS::GetCurrentProcessId()),
+           header->process_id);
+
+  // Walk the records and track where each code object currently lives.
+  std::map<uint64_t, uint64_t> code_addresses;
+  bool found_function = false;
+  size_t offset = header->size;
+  while (offset < length) {
+    CHECK_LE(offset + sizeof(PerfJitDumpRecord), length);
+    const PerfJitDumpRecord* record =
+        reinterpret_cast<const PerfJitDumpRecord*>(data + offset);
+    CHECK_LE(sizeof(PerfJitDumpRecord), record->size);
+    CHECK_LE(offset + record->size, length);
+    if (record->event == 0) {  // JIT_CODE_LOAD
+      const PerfJitDumpCodeLoad* load =
+          static_cast<const PerfJitDumpCodeLoad*>(record);
+      const char* name = data + offset + sizeof(PerfJitDumpCodeLoad);
+      size_t name_length = strlen(name);
+      CHECK_EQ(record->size,
+               sizeof(PerfJitDumpCodeLoad) + name_length + 1 + load->code_size);
+      CHECK_EQ(0u, code_addresses.count(load->code_id));
+      code_addresses[load->code_id] = load->code_address;
+      if (strstr(name, "perfJitTestFunction") != nullptr) {
+        found_function = true;
+      }
+    } else if (record->event == 1) {  // JIT_CODE_MOVE
+      const PerfJitDumpCodeMove* move =
+          static_cast<const PerfJitDumpCodeMove*>(record);
+      CHECK_EQ(sizeof(PerfJitDumpCodeMove), record->size);
+      CHECK_EQ(1u, code_addresses.count(move->code_id));
+      CHECK_EQ(code_addresses[move->code_id], move->old_code_address);
+      code_addresses[move->code_id] = move->new_code_address;
+    }
+    offset += record->size;
+  }
+  CHECK_EQ(length, offset);
+  CHECK(found_function);
+
+  CHECK_NE(code_before_gc, code_after_gc);
+  bool found_move = false;
+  for (const auto& entry : code_addresses) {
+    if (entry.second == code_after_gc) found_move = true;
+  }
+  CHECK(found_move);
+  dump.Dispose();
+
+  i::FLAG_perf_prof = saved_perf_prof;
+  i::FLAG_interpreted_frames_native_stack = saved_native_stack;
+  i::FLAG_ignition = saved_ignition;
+  i::FLAG_manual_evacuation_candidates_selection = saved_manual_evacuation;
+}
+#endif  // V8_OS_LINUX
+
+
+TEST(LogBinaryProfile) {
+  bool saved_prof_binary = i::FLAG_prof_binary;
+  bool saved_prof = i::FLAG_prof;
+  bool saved_prof_cpp = i::FLAG_prof_cpp;
+  bool saved_log_code = i::FLAG_log_code;
+  bool saved_logfile_per_isolate = i::FLAG_logfile_per_isolate;
+  const char* saved_logfile = i::FLAG_logfile;
+  i::FLAG_prof_binary = true;
+  i::FLAG_prof = true;
+  i::FLAG_prof_cpp = true;
+  i::FLAG_logfile = "v8-binary-prof-test.log";
+  i::FLAG_logfile_per_isolate = false;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    v8::Local<v8::Context> env = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(env);
+    CompileRun(
+        "function binaryProfTestFunction(a) { return a + 1; }"
+        "for (var i = 0; i < 1000; i++) binaryProfTestFunction(i);");
+  }
+  isolate->Dispose();
+
+  bool exists = false;
+  i::Vector<const char> log(
+      i::ReadFile("v8-binary-prof-test.log.bin", &exists, true));
+  CHECK(exists);
+  remove("v8-binary-prof-test.log.bin");
+  remove("v8-binary-prof-test.log");
+
+  // Walk the records, see tools/binary-tickprocessor.cc for the layout.
+  size_t length = static_cast<size_t>(log.length());
+  const char* data = log.start();
+  CHECK_LE(8u, length);
+  CHECK_EQ(0, memcmp(data, "V8PB", 4));
+  size_t pos = 8;
+  bool found_function = false;
+  while (pos < length) {
+    char tag = data[pos++];
+    uint32_t name_size;
+    switch (tag) {
+      case 'C':  // code address, code size, name size, name
+        CHECK_LE(pos + 16, length);
+        memcpy(&name_size, data + pos + 12, sizeof(name_size));
+        pos += 16;
+        CHECK_LE(pos + name_size, length);
+        if (StrNStr(data + pos, "binaryProfTestFunction", name_size)) {
+          found_function = true;
+        }
+        pos += name_size;
+        break;
+      case 'M':  // from address, to address
+        pos += 16;
+        break;
+      case 'L':  // start, end, aslr slide, name size, reserved, name
+        CHECK_LE(pos + 32, length);
+        memcpy(&name_size, data + pos + 24, sizeof(name_size));
+        pos += 32 + name_size;
+        break;
+      case 'T': {  // pc, tos, time, state, callback, overflow, frames
+        CHECK_LE(pos + 24, length);
+        uint8_t frames_count = static_cast<uint8_t>(data[pos + 23]);
+        pos += 24 + frames_count * 8;
+        break;
+      }
+      default:
+        CHECK(false);
+    }
+  }
+  CHECK_EQ(length, pos);
+  CHECK(found_function);
+  log.Dispose();
+
+  i::FLAG_prof_binary = saved_prof_binary;
+  i::FLAG_prof = saved_prof;
+  i::FLAG_prof_cpp = saved_prof_cpp;
+  i::FLAG_log_code = saved_log_code;
+  i::FLAG_logfile_per_isolate = saved_logfile_per_isolate;
+  i::FLAG_logfile = saved_logfile;
+}
@@ -0,0 +1,97 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Polymorphic', [1000], [
+  new Benchmark('VisitorDispatch', false, false, 0,
+                VisitorDispatch, PolymorphicSetup, PolymorphicTearDown),
+  new Benchmark('ShapeArea', false, false, 0,
+                ShapeArea, PolymorphicSetup, PolymorphicTearDown),
+  new Benchmark('CallbackReduce', false, false, 0,
+                CallbackReduce, PolymorphicSetup, PolymorphicTearDown)
+]);
+
+var result;
+var tree;
+var shapes;
+var values;
+
+function Num(value) { this.value = value; }
+Num.prototype.accept = function(v) { return v.visitNum(this); };
+
+function Add(left, right) { this.left = left; this.right = right; }
+Add.prototype.accept = function(v) { return v.visitAdd(this); };
+
+function Mul(left, right) { this.left = left; this.right = right; }
+Mul.prototype.accept = function(v) { return v.visitMul(this); };
+
+var evaluator = {
+  visitNum: function(n) { return n.value; },
+  visitAdd: function(n) { return n.left.accept(this) + n.right.accept(this); },
+  visitMul: function(n) { return n.left.accept(this) * n.right.accept(this); }
+};
+
+function Circle(r) { this.r = r; }
+Circle.prototype.area = function() { return 3 * this.r * this.r; };
+
+function Square(a) { this.a = a; }
+Square.prototype.area = function() { return this.a * this.a; };
+
+function Rect(w, h) { this.w = w; this.h = h; }
+Rect.prototype.area = function() { return this.w * this.h; };
+
+function BuildTree(depth) {
+  if (depth == 0) return new Num(depth + 1);
+  var left = BuildTree(depth - 1);
+  var right = new Num(depth);
+  return (depth & 1) ? new Add(left, right) : new Mul(left, right);
+}
+
+function PolymorphicSetup() {
+  result = 0;
+  tree = BuildTree(8);
+  shapes = [];
+  for (var i = 0; i < 300; i++) {
+    shapes.push(new Circle(i % 7));
+    shapes.push(new Square(i % 5));
+    shapes.push(new Rect(i % 3, i % 11));
+  }
+  values = [];
+  for (var i = 0; i < 1000; i++) values.push(i % 17);
+}
+
+function PolymorphicTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function VisitorDispatch() {
+  for (var i = 0; i < 10; i++) {
+    result += tree.accept(evaluator) & 0xff;
+  }
+}
+
+function ShapeArea() {
+  var sum = 0;
+  for (var i = 0; i < shapes.length; i++) {
+    sum += shapes[i].area();
+  }
+  result += sum;
+}
+
+function add(a, b) { return a + b; }
+function max(a, b) { return a > b ? a : b; }
+
+function Reduce(callback, initial) {
+  var acc = initial;
+  for (var i = 0; i < values.length; i++) {
+    acc = callback(acc, values[i]);
+  }
+  return acc;
+}
+
+function CallbackReduce() {
+  result += Reduce(add, 0);
+  result += Reduce(max, 0);
+}
@@ -0,0 +1,81 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Lookups, inserts and deletes on dictionary-mode objects of growing size,
+// and lookups that have to go through the string table first.
+
+var kSizes = [16, 128, 1024, 8192];
+
+for (var i = 0; i < kSizes.length; i++) {
+  var size = kSizes[i];
+  new BenchmarkSuite('Dictionary' + size, [1000], [
+    new Benchmark('Lookup', false, false, 0, Lookup, MakeSetup(size),
+                  TearDown),
+    new Benchmark('InsertDelete', false, false, 0, InsertDelete,
+                  MakeSetup(size), TearDown),
+    new Benchmark('ComputedLookup', false, false, 0, ComputedLookup,
+                  MakeSetup(size), TearDown)
+  ]);
+}
+
+var kOperations = 4096;
+
+var dict;
+var keys;
+var result;
+
+function MakeSetup(size) {
+  return function() {
+    dict = {};
+    keys = [];
+    for (var i = 0; i < size; i++) {
+      var key = 'key' + i;
+      keys.push(key);
+      dict[key] = i;
+    }
+    // Force dictionary mode also for the small sizes.
+    delete dict[keys[0]];
+    dict[keys[0]] = 0;
+    result = 0;
+  };
+}
+
+function TearDown() {
+  if (typeof result !== 'number' || result < 0) {
+    throw new Error('Bad result: ' + result);
+  }
+  dict = null;
+  keys = null;
+}
+
+function Lookup() {
+  var sum = 0;
+  var length = keys.length;
+  for (var i = 0; i < kOperations; i++) {
+    sum += dict[keys[i % length]];
+  }
+  result = sum;
+}
+
+function InsertDelete() {
+  var length = keys.length;
+  for (var i = 0; i < kOperations; i++) {
+    var key = keys[i % length];
+    var value = dict[key];
+    delete dict[key];
+    dict[key] = value;
+  }
+  result = length;
+}
+
+function ComputedLookup() {
+  // The keys are built from pieces, so every access has to look them up in
+  // the string table before probing the dictionary.
+  var sum = 0;
+  var length = keys.length;
+  for (var i = 0; i < kOperations; i++) {
+    sum += dict['key' + (i % length)];
+  }
+  result = sum;
+}
@@ -5,6 +5,7 @@
 
 load('../base.js');
 load('try-catch.js');
+load('throw-error.js');
 
 var success = true;
 
@@ -0,0 +1,80 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Throw-Error', [1000], [
+  new Benchmark('ThrowNewError', false, false, 0,
+                ThrowNewError, ThrowNewErrorSetup,
+                ThrowNewErrorTearDown),
+  new Benchmark('ThrowNewErrorDeep', false, false, 0,
+                ThrowNewErrorDeep, ThrowNewErrorDeepSetup,
+                ThrowNewErrorDeepTearDown),
+  new Benchmark('ThrowNewErrorReadStack', false, false, 0,
+                ThrowNewErrorReadStack, ThrowNewErrorReadStackSetup,
+                ThrowNewErrorReadStackTearDown)
+]);
+
+var count;
+var stack_length;
+
+function Thrower(depth) {
+  if (depth > 0) return Thrower(depth - 1);
+  throw new Error('Test error');
+}
+
+// ----------------------------------------------------------------------------
+
+function ThrowNewErrorSetup() {
+  count = 0;
+}
+
+function ThrowNewError() {
+  try {
+    Thrower(0);
+  }
+  catch (e) {
+    count++;
+  }
+}
+
+function ThrowNewErrorTearDown() {
+  return count > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function ThrowNewErrorDeepSetup() {
+  count = 0;
+}
+
+function ThrowNewErrorDeep() {
+  try {
+    Thrower(20);
+  }
+  catch (e) {
+    count++;
+  }
+}
+
+function ThrowNewErrorDeepTearDown() {
+  return count > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function ThrowNewErrorReadStackSetup() {
+  stack_length = 0;
+}
+
+function ThrowNewErrorReadStack() {
+  try {
+    Thrower(5);
+  }
+  catch (e) {
+    stack_length = e.stack.length;
+  }
+}
+
+function ThrowNewErrorReadStackTearDown() {
+  return stack_length > 0;
+}
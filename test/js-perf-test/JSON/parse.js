@@ -0,0 +1,91 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.parse of payloads shaped like typical REST API responses: lists of
+// records that share a shape, records whose optional fields make the shapes
+// diverge, and records dominated by long string values.
+
+new BenchmarkSuite('ParseUniformRecords', [1000], [
+  new Benchmark('ParseUniformRecords', false, false, 0, Parse,
+                MakeSetup(UniformRecord), TearDown)
+]);
+
+new BenchmarkSuite('ParseMixedRecords', [1000], [
+  new Benchmark('ParseMixedRecords', false, false, 0, Parse,
+                MakeSetup(MixedRecord), TearDown)
+]);
+
+new BenchmarkSuite('ParseLongStrings', [1000], [
+  new Benchmark('ParseLongStrings', false, false, 0, Parse,
+                MakeSetup(LongStringRecord), TearDown)
+]);
+
+var kRecords = 100;
+
+var payload;
+var result;
+
+function UniformRecord(i) {
+  return {
+    id: i,
+    login: 'user' + i,
+    name: 'User Number ' + i,
+    email: 'user' + i + '@example.com',
+    active: (i & 1) === 0,
+    score: i * 1.5,
+    created_at: '2016-08-' + (10 + i % 20) + 'T12:00:00Z',
+    tags: ['a', 'b', 'c'],
+    address: {street: i + ' Main St', city: 'Springfield', zip: '12345'}
+  };
+}
+
+function MixedRecord(i) {
+  // The first fields are shared, then the shape forks three ways.
+  var record = {id: i, type: 'event', created_at: '2016-08-01T12:00:00Z'};
+  switch (i % 3) {
+    case 0:
+      record.actor = 'user' + i;
+      record.repo = 'project' + i;
+      break;
+    case 1:
+      record.payload = {size: i, ref: 'refs/heads/master'};
+      record.public = true;
+      break;
+    case 2:
+      record.org = 'org' + i;
+      record.actor = 'user' + i;
+      break;
+  }
+  return record;
+}
+
+function LongStringRecord(i) {
+  var text = '';
+  for (var j = 0; j < 16; j++) {
+    text += 'Lorem ipsum dolor sit amet, consectetur adipiscing elit. ';
+  }
+  return {id: i, title: 'Item ' + i, body: text, footer: text + i};
+}
+
+function MakeSetup(make_record) {
+  return function() {
+    var records = [];
+    for (var i = 0; i < kRecords; i++) records.push(make_record(i));
+    payload = JSON.stringify({data: records, total: kRecords});
+    result = null;
+  };
+}
+
+function Parse() {
+  result = JSON.parse(payload);
+}
+
+function TearDown() {
+  if (result.total !== kRecords || result.data.length !== kRecords ||
+      result.data[kRecords - 1].id !== kRecords - 1) {
+    throw new Error('Bad result: ' + result);
+  }
+  payload = null;
+  result = null;
+}
@@ -0,0 +1,71 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// JSON.stringify of large arrays of homogeneous records, with short string
+// values, long plain string values and strings that need escaping.
+
+new BenchmarkSuite('StringifyUniformRecords', [1000], [
+  new Benchmark('StringifyUniformRecords', false, false, 0, Stringify,
+                MakeStringifySetup(ShortStringRecord), StringifyTearDown)
+]);
+
+new BenchmarkSuite('StringifyLongStrings', [1000], [
+  new Benchmark('StringifyLongStrings', false, false, 0, Stringify,
+                MakeStringifySetup(LongStringRecord), StringifyTearDown)
+]);
+
+new BenchmarkSuite('StringifyEscapedStrings', [1000], [
+  new Benchmark('StringifyEscapedStrings', false, false, 0, Stringify,
+                MakeStringifySetup(EscapedStringRecord), StringifyTearDown)
+]);
+
+var kStringifyRecords = 1000;
+
+var records;
+var output;
+
+function ShortStringRecord(i) {
+  return {
+    id: i,
+    login: 'user' + i,
+    email: 'user' + i + '@example.com',
+    active: (i & 1) === 0,
+    score: i * 1.5,
+    created_at: '2016-08-01T12:00:00Z'
+  };
+}
+
+var kLongText = '';
+for (var i = 0; i < 8; i++) {
+  kLongText += 'Lorem ipsum dolor sit amet, consectetur adipiscing elit. ';
+}
+
+function LongStringRecord(i) {
+  return {id: i, title: 'Item ' + i, body: kLongText};
+}
+
+function EscapedStringRecord(i) {
+  return {id: i, path: 'C:\\Users\\user' + i, quote: '"' + i + '"\n'};
+}
+
+function MakeStringifySetup(make_record) {
+  return function() {
+    records = [];
+    for (var i = 0; i < kStringifyRecords; i++) records.push(make_record(i));
+    output = null;
+  };
+}
+
+function Stringify() {
+  output = JSON.stringify(records);
+}
+
+function StringifyTearDown() {
+  if (typeof output !== 'string' ||
+      JSON.parse(output).length !== kStringifyRecords) {
+    throw new Error('Bad output: ' + output);
+  }
+  records = null;
+  output = null;
+}
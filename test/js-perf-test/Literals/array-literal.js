@@ -0,0 +1,66 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Array-Literal', [1000], [
+  new Benchmark('EmptyArrayLiteral', false, false, 0,
+                EmptyArrayLiteral, ArrayLiteralSetup, ArrayLiteralTearDown),
+  new Benchmark('ConstantArrayLiteral', false, false, 0,
+                ConstantArrayLiteral, ArrayLiteralSetup,
+                ArrayLiteralTearDown),
+  new Benchmark('DoubleArrayLiteral', false, false, 0,
+                DoubleArrayLiteral, ArrayLiteralSetup, ArrayLiteralTearDown),
+  new Benchmark('ComputedArrayLiteral', false, false, 0,
+                ComputedArrayLiteral, ArrayLiteralSetup,
+                ArrayLiteralTearDown),
+  new Benchmark('NestedArrayLiteral', false, false, 0,
+                NestedArrayLiteral, ArrayLiteralSetup, ArrayLiteralTearDown)
+]);
+
+var result;
+var x = 10;
+
+function ArrayLiteralSetup() {
+  result = 0;
+}
+
+function ArrayLiteralTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function EmptyArrayLiteral() {
+  for (var i = 0; i < 1000; i++) {
+    var a = [];
+    result += a.length + 1;
+  }
+}
+
+function ConstantArrayLiteral() {
+  for (var i = 0; i < 1000; i++) {
+    var a = [1, 2, 3, 4, 5, 6, 7, 8];
+    result += a[i & 7];
+  }
+}
+
+function DoubleArrayLiteral() {
+  for (var i = 0; i < 1000; i++) {
+    var a = [1.5, 2.5, 3.5, 4.5];
+    result += a[i & 3];
+  }
+}
+
+function ComputedArrayLiteral() {
+  for (var i = 0; i < 1000; i++) {
+    var a = [i, x, i + x, 'a'];
+    result += a[2];
+  }
+}
+
+function NestedArrayLiteral() {
+  for (var i = 0; i < 1000; i++) {
+    var a = [[1, 2], [3, 4]];
+    result += a[i & 1][1];
+  }
+}
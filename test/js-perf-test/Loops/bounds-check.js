@@ -0,0 +1,66 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Bounds-Check', [1000], [
+  new Benchmark('Float64ArrayScale', false, false, 0,
+                Float64ArrayScale, BoundsCheckSetup, BoundsCheckTearDown),
+  new Benchmark('Uint8ArrayInvert', false, false, 0,
+                Uint8ArrayInvert, BoundsCheckSetup, BoundsCheckTearDown),
+  new Benchmark('Uint8ArrayHistogram', false, false, 0,
+                Uint8ArrayHistogram, BoundsCheckSetup, BoundsCheckTearDown),
+  new Benchmark('ArraySum', false, false, 0,
+                ArraySum, BoundsCheckSetup, BoundsCheckTearDown)
+]);
+
+// The typed arrays are only assigned once, so that optimized code can embed
+// them as constants, as it does for audio and image buffers.
+var samples = new Float64Array(1024);
+var pixels = new Uint8Array(4096);
+var histogram = new Uint32Array(256);
+var values = [];
+for (var i = 0; i < samples.length; i++) samples[i] = i / samples.length;
+for (var i = 0; i < pixels.length; i++) pixels[i] = i & 0xff;
+for (var i = 0; i < 1024; i++) values.push(i);
+
+var result;
+
+function BoundsCheckSetup() {
+  result = 0;
+}
+
+function BoundsCheckTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function Float64ArrayScale() {
+  for (var i = 0; i < 1024; i++) {
+    samples[i] = samples[i] * 0.5 + 0.25;
+  }
+  result += samples[1023] + 1;
+}
+
+function Uint8ArrayInvert() {
+  for (var i = 0; i < 4096; i++) {
+    pixels[i] = 255 - pixels[i];
+  }
+  result += pixels[1] + 1;
+}
+
+function Uint8ArrayHistogram() {
+  for (var i = 0; i < 256; i++) histogram[i] = 0;
+  for (var i = 0; i < 4096; i++) {
+    histogram[pixels[i]]++;
+  }
+  result += histogram[0] + 1;
+}
+
+function ArraySum() {
+  var sum = 0;
+  for (var i = 0; i < values.length; i++) {
+    sum += values[i];
+  }
+  result += sum;
+}
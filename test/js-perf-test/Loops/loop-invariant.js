@@ -0,0 +1,73 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Loop-Invariant', [1000], [
+  new Benchmark('ArrayLength', false, false, 0,
+                ArrayLength, LoopInvariantSetup, LoopInvariantTearDown),
+  new Benchmark('ObjectField', false, false, 0,
+                ObjectField, LoopInvariantSetup, LoopInvariantTearDown),
+  new Benchmark('TypedArrayKernel', false, false, 0,
+                TypedArrayKernel, LoopInvariantSetup, LoopInvariantTearDown),
+  new Benchmark('NestedLoops', false, false, 0,
+                NestedLoops, LoopInvariantSetup, LoopInvariantTearDown)
+]);
+
+var result;
+var array;
+var config;
+var input;
+var output;
+var matrix;
+
+function LoopInvariantSetup() {
+  result = 0;
+  array = [];
+  for (var i = 0; i < 1000; i++) array.push(i);
+  config = {offset: 3, scale: 2};
+  input = new Float64Array(1000);
+  output = new Float64Array(1000);
+  for (var i = 0; i < input.length; i++) input[i] = i * 0.5;
+  matrix = [];
+  for (var i = 0; i < 32; i++) matrix.push(array.slice(0, 32));
+}
+
+function LoopInvariantTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function ArrayLength() {
+  var sum = 0;
+  for (var i = 0; i < array.length; i++) {
+    sum += array[i];
+  }
+  result += sum;
+}
+
+function ObjectField() {
+  var sum = 0;
+  for (var i = 0; i < 1000; i++) {
+    sum += config.offset + config.scale * i;
+  }
+  result += sum;
+}
+
+function TypedArrayKernel() {
+  for (var i = 0; i < input.length; i++) {
+    output[i] = input[i] * config.scale + config.offset;
+  }
+  result += output[output.length - 1];
+}
+
+function NestedLoops() {
+  var sum = 0;
+  for (var i = 0; i < matrix.length; i++) {
+    var row = matrix[i];
+    for (var j = 0; j < row.length; j++) {
+      sum += row[j] * config.scale;
+    }
+  }
+  result += sum;
+}
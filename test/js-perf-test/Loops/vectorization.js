@@ -0,0 +1,67 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+new BenchmarkSuite('Vectorization', [1000], [
+  new Benchmark('Saxpy', false, false, 0,
+                Saxpy, VectorizationSetup, VectorizationTearDown),
+  new Benchmark('Convolution', false, false, 0,
+                Convolution, VectorizationSetup, VectorizationTearDown),
+  new Benchmark('RgbaBlend', false, false, 0,
+                RgbaBlend, VectorizationSetup, VectorizationTearDown)
+]);
+
+// As in the Bounds-Check suite, the typed arrays are only assigned once, so
+// that optimized code can embed their backing stores as constants. The
+// float32 kernels round every intermediate result with Math.fround, which
+// is what makes them computable with float32 lanes.
+var saxpyX = new Float32Array(4096);
+var saxpyY = new Float32Array(4096);
+var signal = new Int32Array(4099);
+var smoothed = new Int32Array(4099);
+var foreground = new Float32Array(4 * 1024);
+var background = new Float32Array(4 * 1024);
+var blended = new Float32Array(4 * 1024);
+for (var i = 0; i < saxpyX.length; i++) saxpyX[i] = i / 8;
+for (var i = 0; i < signal.length; i++) signal[i] = (i * 7919) & 0xffff;
+for (var i = 0; i < foreground.length; i++) {
+  foreground[i] = (i & 0xff) / 255;
+  background[i] = ((i * 3) & 0xff) / 255;
+}
+
+var result;
+
+function VectorizationSetup() {
+  result = 0;
+  for (var i = 0; i < saxpyY.length; i++) saxpyY[i] = 1;
+}
+
+function VectorizationTearDown() {
+  return result > 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function Saxpy() {
+  for (var i = 0; i < 4096; i++) {
+    saxpyY[i] = Math.fround(0.5 * saxpyX[i]) + saxpyY[i];
+  }
+  result += saxpyY[4095];
+}
+
+function Convolution() {
+  // Three tap integer filter with the kernel (1, 2, 1) / 4.
+  for (var i = 1; i < 4098; i++) {
+    smoothed[i] = (signal[i - 1] + 2 * signal[i] + signal[i + 1]) >> 2;
+  }
+  result += smoothed[4097] + 1;
+}
+
+function RgbaBlend() {
+  // Blends two images with 75% opacity, all four channels at once.
+  for (var i = 0; i < 4096; i++) {
+    blended[i] = Math.fround(foreground[i] * 0.75) +
+                 Math.fround(background[i] * 0.25);
+  }
+  result += blended[4095] + 1;
+}
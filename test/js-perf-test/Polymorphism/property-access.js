@@ -0,0 +1,64 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Named property loads and stores at a single site that sees a growing number
+// of receiver shapes.
+
+var kShapeCounts = [1, 2, 4, 6, 8, 12, 16, 32];
+var kObjectCount = 256;
+
+for (var i = 0; i < kShapeCounts.length; i++) {
+  var count = kShapeCounts[i];
+  new BenchmarkSuite('Shapes' + count, [1000], [
+    new Benchmark('Load', false, false, 0, MakeLoad(count), MakeSetup(count),
+                  TearDown),
+    new Benchmark('Store', false, false, 0, MakeStore(count),
+                  MakeSetup(count), TearDown)
+  ]);
+}
+
+var objects;
+var result;
+
+function MakeObject(shape, value) {
+  // Every shape has a distinct leading property, followed by the common
+  // property that is accessed by the benchmarks.
+  var o = {};
+  o['s' + shape] = shape;
+  o.x = value;
+  return o;
+}
+
+function MakeSetup(count) {
+  return function() {
+    objects = [];
+    for (var i = 0; i < kObjectCount; i++) {
+      objects.push(MakeObject(i % count, i));
+    }
+    result = 0;
+  };
+}
+
+function TearDown() {
+  if (typeof result !== 'number' || result <= 0) {
+    throw new Error('Bad result: ' + result);
+  }
+  objects = null;
+}
+
+// Each shape count gets its own load/store site, so that the ICs of different
+// shape counts do not interfere. The trailing comment keeps the compilation
+// cache from sharing the function between shape counts.
+function MakeLoad(count) {
+  return new Function(
+      'var sum = 0;' +
+      'for (var i = 0; i < objects.length; i++) sum += objects[i].x;' +
+      'result = sum; // ' + count);
+}
+
+function MakeStore(count) {
+  return new Function(
+      'for (var i = 0; i < objects.length; i++) objects[i].x = i;' +
+      'result = objects.length; // ' + count);
+}
@@ -0,0 +1,88 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Kernels made of long basic blocks with several independent dependency
+// chains, whose speed mostly depends on how well the instructions are
+// interleaved to hide their latencies.
+new BenchmarkSuite('Kernels', [1000], [
+  new Benchmark('HashMix', false, false, 0,
+                HashMix, KernelsSetup, KernelsTearDown),
+  new Benchmark('Matrix4Multiply', false, false, 0,
+                Matrix4Multiply, KernelsSetup, KernelsTearDown),
+  new Benchmark('Polynomials', false, false, 0,
+                Polynomials, KernelsSetup, KernelsTearDown)
+]);
+
+var keys = new Int32Array(1024);
+var hashes = new Int32Array(1024);
+var matrixA = new Float64Array(16);
+var matrixB = new Float64Array(16);
+var matrixC = new Float64Array(16);
+var points = new Float64Array(1024);
+for (var i = 0; i < keys.length; i++) keys[i] = i * 2654435761;
+for (var i = 0; i < 16; i++) {
+  matrixA[i] = i / 16;
+  matrixB[i] = (16 - i) / 16;
+}
+for (var i = 0; i < points.length; i++) points[i] = i / points.length;
+
+var result;
+
+function KernelsSetup() {
+  result = 0;
+}
+
+function KernelsTearDown() {
+  return result != 0;
+}
+
+// ----------------------------------------------------------------------------
+
+function Mix(h) {
+  h = Math.imul(h ^ (h >>> 16), 0x85ebca6b);
+  h = Math.imul(h ^ (h >>> 13), 0xc2b2ae35);
+  return h ^ (h >>> 16);
+}
+
+function HashMix() {
+  for (var i = 0; i < 1024; i += 4) {
+    hashes[i] = Mix(keys[i]);
+    hashes[i + 1] = Mix(keys[i + 1]);
+    hashes[i + 2] = Mix(keys[i + 2]);
+    hashes[i + 3] = Mix(keys[i + 3]);
+  }
+  result += hashes[1023] | 1;
+}
+
+function Multiply(a, b, c) {
+  for (var i = 0; i < 16; i += 4) {
+    var a0 = a[i], a1 = a[i + 1], a2 = a[i + 2], a3 = a[i + 3];
+    c[i] = a0 * b[0] + a1 * b[4] + a2 * b[8] + a3 * b[12];
+    c[i + 1] = a0 * b[1] + a1 * b[5] + a2 * b[9] + a3 * b[13];
+    c[i + 2] = a0 * b[2] + a1 * b[6] + a2 * b[10] + a3 * b[14];
+    c[i + 3] = a0 * b[3] + a1 * b[7] + a2 * b[11] + a3 * b[15];
+  }
+}
+
+function Matrix4Multiply() {
+  for (var i = 0; i < 64; i++) {
+    Multiply(matrixA, matrixB, matrixC);
+    Multiply(matrixB, matrixA, matrixC);
+  }
+  result += matrixC[0] + 1;
+}
+
+function Polynomials() {
+  // Evaluates the Taylor polynomials of sin, cos and exp at once.
+  var sum = 0;
+  for (var i = 0; i < 1024; i++) {
+    var x = points[i];
+    var x2 = x * x;
+    var s = x * (1 - x2 / 6 * (1 - x2 / 20 * (1 - x2 / 42)));
+    var c = 1 - x2 / 2 * (1 - x2 / 12 * (1 - x2 / 30));
+    var e = 1 + x * (1 + x / 2 * (1 + x / 3 * (1 + x / 4)));
+    sum += s + c + e;
+  }
+  result += sum;
+}
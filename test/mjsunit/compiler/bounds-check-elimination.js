@@ -0,0 +1,62 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-bounds-check-elimination
+// Flags: --turbo-loop-variable
+
+(function SumUpToLength() {
+  function sum(a) {
+    var s = 0;
+    for (var i = 0; i < a.length; i++) s += a[i];
+    return s;
+  }
+  assertEquals(6, sum([1, 2, 3]));
+  assertEquals(10, sum([1, 2, 3, 4]));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(15, sum([1, 2, 3, 4, 5]));
+  assertEquals(0, sum([]));
+})();
+
+(function OffByOne() {
+  function last(a) {
+    var s;
+    for (var i = 0; i <= a.length; i++) s = a[i];
+    return s;
+  }
+  assertEquals(undefined, last([1, 2, 3]));
+  assertEquals(undefined, last([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(last);
+  assertEquals(undefined, last([1, 2, 3]));
+})();
+
+(function CountingDown() {
+  function first(a) {
+    var s;
+    for (var i = a.length - 1; i >= -1; i--) s = a[i];
+    return s;
+  }
+  assertEquals(undefined, first([1, 2, 3]));
+  assertEquals(undefined, first([1, 2, 3]));
+  %OptimizeFunctionOnNextCall(first);
+  assertEquals(undefined, first([1, 2, 3]));
+})();
+
+var bytes = new Uint8Array(16);
+var doubles = new Float64Array(16);
+
+(function TypedArrays() {
+  function fill(n) {
+    for (var i = 0; i < n; i++) {
+      bytes[i] = i;
+      doubles[i] = i / 2;
+    }
+    return bytes[n - 1] + doubles[n - 1];
+  }
+  assertEquals(4.5, fill(4));
+  assertEquals(4.5, fill(4));
+  %OptimizeFunctionOnNextCall(fill);
+  assertEquals(22.5, fill(16));
+  assertEquals(NaN, fill(20));
+  assertEquals(undefined, bytes[19]);
+})();
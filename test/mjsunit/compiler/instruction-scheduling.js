@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-instruction-scheduling
+
+(function IndependentChains() {
+  function f(a, b, c, d) {
+    var x = Math.imul(a, 3) + 1;
+    var y = Math.imul(b, 5) ^ 7;
+    var z = (c << 3) - d;
+    var w = (d >>> 1) | a;
+    return (x + y) ^ (z - w);
+  }
+  var expected = f(1, 2, 3, 4);
+  assertEquals(expected, f(1, 2, 3, 4));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f(1, 2, 3, 4));
+})();
+
+(function HighRegisterPressure() {
+  // More live values than there are registers on any target.
+  function f(a) {
+    var v0 = a[0] * 2, v1 = a[1] * 3, v2 = a[2] * 4, v3 = a[3] * 5;
+    var v4 = a[4] * 6, v5 = a[5] * 7, v6 = a[6] * 8, v7 = a[7] * 9;
+    var v8 = a[8] + v0, v9 = a[9] + v1, v10 = a[10] + v2, v11 = a[11] + v3;
+    var v12 = a[12] + v4, v13 = a[13] + v5, v14 = a[14] + v6;
+    var v15 = a[15] + v7, v16 = a[0] - v8, v17 = a[1] - v9;
+    return v0 + v1 * v2 - v3 + v4 * v5 - v6 + v7 * v8 - v9 + v10 * v11 -
+           v12 + v13 * v14 - v15 + v16 * v17;
+  }
+  var a = new Float64Array(16);
+  for (var i = 0; i < a.length; i++) a[i] = i + 0.5;
+  var expected = f(a);
+  assertEquals(expected, f(a));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected, f(a));
+})();
+
+(function LoadsAndStores() {
+  function f(a, b) {
+    var x = a[0];
+    b[0] = x + 1;
+    var y = a[0];
+    b[1] = y * 2;
+    a[0] = b[0] + b[1];
+    return a[0] - x;
+  }
+  var a = new Int32Array(2);
+  var b = new Int32Array(2);
+  a[0] = 3;
+  assertEquals(7, f(a, b));
+  a[0] = 3;
+  assertEquals(7, f(a, b));
+  %OptimizeFunctionOnNextCall(f);
+  a[0] = 3;
+  assertEquals(7, f(a, b));
+  // Aliased arrays must observe the stores in program order.
+  a[0] = 3;
+  assertEquals(9, f(a, a));
+})();
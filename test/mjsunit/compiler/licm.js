@@ -0,0 +1,61 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-licm
+
+(function InvariantField() {
+  function sum(o, n) {
+    var s = 0;
+    for (var i = 0; i < n; i++) s += o.x;
+    return s;
+  }
+  assertEquals(6, sum({x: 2}, 3));
+  assertEquals(9, sum({x: 3}, 3));
+  %OptimizeFunctionOnNextCall(sum);
+  assertEquals(8, sum({x: 4}, 2));
+  assertEquals(0, sum({x: 4}, 0));
+})();
+
+(function FieldWrittenInLoop() {
+  function count(o, n) {
+    var s = 0;
+    for (var i = 0; i < n; i++) {
+      s += o.x;
+      o.x = i;
+    }
+    return s;
+  }
+  assertEquals(5 + 0 + 1, count({x: 5}, 3));
+  assertEquals(5 + 0 + 1, count({x: 5}, 3));
+  %OptimizeFunctionOnNextCall(count);
+  assertEquals(5 + 0 + 1 + 2, count({x: 5}, 4));
+})();
+
+(function LengthChangedByCall() {
+  function drain(a) {
+    var n = 0;
+    for (var i = 0; i < a.length; i++) {
+      a.pop();
+      n++;
+    }
+    return n;
+  }
+  assertEquals(2, drain([1, 2, 3, 4]));
+  assertEquals(2, drain([1, 2, 3, 4]));
+  %OptimizeFunctionOnNextCall(drain);
+  assertEquals(3, drain([1, 2, 3, 4, 5, 6]));
+})();
+
+(function InvariantCheckDeoptimizes() {
+  function load(o, n) {
+    var s = 0;
+    for (var i = 0; i < n; i++) s += o.x;
+    return s;
+  }
+  assertEquals(2, load({x: 1}, 2));
+  assertEquals(2, load({x: 1}, 2));
+  %OptimizeFunctionOnNextCall(load);
+  assertEquals(2, load({x: 1}, 2));
+  assertEquals("0aa", load({y: 0, x: "a"}, 2));
+})();
@@ -0,0 +1,151 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-loop-vectorization
+
+// Only loops whose element accesses are free of bounds checks are vectorized,
+// so the loops below are bounded by the (constant) lengths of the arrays
+// rather than by a parameter.
+
+var f32a = new Float32Array(19);
+var f32b = new Float32Array(19);
+var i32a = new Int32Array(19);
+var i32b = new Int32Array(19);
+var u32a = new Uint32Array(19);
+
+function reset() {
+  for (var i = 0; i < 19; i++) {
+    f32a[i] = i / 3;
+    f32b[i] = 0;
+    i32a[i] = i * 0x1234567 - 7;
+    i32b[i] = 0;
+    u32a[i] = 0xfffffff0 + i;
+  }
+}
+
+(function Float32Scale() {
+  function scale19() {
+    for (var i = 0; i < 19; i++) f32b[i] = Math.fround(f32a[i] * 0.5) + 1;
+  }
+  function scale16() {
+    for (var i = 0; i < 16; i++) f32b[i] = Math.fround(f32a[i] * 0.5) + 1;
+  }
+  function scale3() {
+    for (var i = 0; i < 3; i++) f32b[i] = Math.fround(f32a[i] * 0.5) + 1;
+  }
+  function check(n) {
+    for (var i = 0; i < 19; i++) {
+      var expected = i < n ? Math.fround(Math.fround(i / 3) * 0.5) + 1 : 0;
+      assertEquals(Math.fround(expected), f32b[i]);
+    }
+  }
+  // Cover the vector loop with and without the scalar epilogue, as well as
+  // the scalar epilogue alone.
+  [[scale19, 19], [scale16, 16], [scale3, 3]].forEach(function(test) {
+    var scale = test[0], n = test[1];
+    reset();
+    scale();
+    check(n);
+    %OptimizeFunctionOnNextCall(scale);
+    reset();
+    scale();
+    check(n);
+  });
+})();
+
+(function Float32Offsets() {
+  function shift() {
+    for (var i = 1; i < 19; i++) f32b[i - 1] = f32a[i] - f32a[i - 1];
+  }
+  reset();
+  shift();
+  %OptimizeFunctionOnNextCall(shift);
+  reset();
+  shift();
+  for (var i = 0; i < 18; i++) {
+    assertEquals(Math.fround(Math.fround((i + 1) / 3) - Math.fround(i / 3)),
+                 f32b[i]);
+  }
+  assertEquals(0, f32b[18]);
+})();
+
+(function Float64OperationsAreNotFused() {
+  function axpy() {
+    // Without the Math.fround the product is not rounded to float32 before
+    // the addition, so this loop must not use float32 lanes.
+    for (var i = 0; i < 19; i++) f32b[i] = f32a[i] * 0.1 + f32b[i];
+  }
+  reset();
+  axpy();
+  %OptimizeFunctionOnNextCall(axpy);
+  reset();
+  axpy();
+  for (var i = 0; i < 19; i++) {
+    assertEquals(Math.fround(Math.fround(i / 3) * 0.1), f32b[i]);
+  }
+})();
+
+(function OverlappingStores() {
+  function prefix() {
+    // Every iteration reads the element written by the previous one.
+    for (var i = 0; i < 18; i++) i32a[i + 1] = i32a[i] + 1;
+  }
+  reset();
+  prefix();
+  %OptimizeFunctionOnNextCall(prefix);
+  reset();
+  prefix();
+  for (var i = 0; i < 19; i++) assertEquals(i - 7, i32a[i]);
+})();
+
+(function InPlaceUpdate() {
+  function update() {
+    for (var i = 0; i < 19; i++) i32a[i] = i32a[i] ^ 0xff;
+  }
+  reset();
+  update();
+  %OptimizeFunctionOnNextCall(update);
+  reset();
+  update();
+  for (var i = 0; i < 19; i++) {
+    assertEquals((i * 0x1234567 - 7) ^ 0xff, i32a[i]);
+  }
+})();
+
+(function Int32Arithmetic() {
+  function compute() {
+    for (var i = 0; i < 18; i++) {
+      i32b[i] = ((i32a[i] * 3 - i32a[i + 1]) << 2) + (i32a[i] >> 3);
+    }
+  }
+  function check() {
+    for (var i = 0; i < 18; i++) {
+      var a = i * 0x1234567 - 7;
+      var b = (i + 1) * 0x1234567 - 7;
+      assertEquals(((Math.imul(a, 3) - b) << 2) + (a >> 3), i32b[i]);
+    }
+  }
+  reset();
+  compute();
+  check();
+  %OptimizeFunctionOnNextCall(compute);
+  reset();
+  compute();
+  check();
+})();
+
+(function Uint32Shifts() {
+  function compute() {
+    for (var i = 0; i < 19; i++) u32a[i] = (u32a[i] >>> 4) | (u32a[i] << 28);
+  }
+  reset();
+  compute();
+  %OptimizeFunctionOnNextCall(compute);
+  reset();
+  compute();
+  for (var i = 0; i < 19; i++) {
+    var x = 0xfffffff0 + i;
+    assertEquals(((x >>> 4) | (x << 28)) >>> 0, u32a[i]);
+  }
+})();
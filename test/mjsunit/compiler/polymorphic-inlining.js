@@ -0,0 +1,62 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo --turbo-polymorphic-inlining
+
+(function VisitorDispatch() {
+  function Num(value) { this.value = value; }
+  Num.prototype.accept = function(v) { return v.visitNum(this); };
+  function Add(left, right) { this.left = left; this.right = right; }
+  Add.prototype.accept = function(v) { return v.visitAdd(this); };
+  function Neg(operand) { this.operand = operand; }
+  Neg.prototype.accept = function(v) { return v.visitNeg(this); };
+
+  var evaluator = {
+    visitNum: function(n) { return n.value; },
+    visitAdd: function(n) {
+      return visit(n.left, this) + visit(n.right, this);
+    },
+    visitNeg: function(n) { return -visit(n.operand, this); }
+  };
+  function visit(node, visitor) { return node.accept(visitor); }
+
+  var tree = new Add(new Num(1), new Add(new Num(2), new Num(3)));
+  assertEquals(6, visit(tree, evaluator));
+  assertEquals(6, visit(tree, evaluator));
+  %OptimizeFunctionOnNextCall(visit);
+  assertEquals(6, visit(tree, evaluator));
+  assertEquals(-6, visit(new Neg(tree), evaluator));
+})();
+
+(function CallbackSelection() {
+  function inc(x) { return x + 1; }
+  function dec(x) { return x - 1; }
+  function apply(up, x) {
+    var f = up ? inc : dec;
+    return f(x);
+  }
+  assertEquals(2, apply(true, 1));
+  assertEquals(0, apply(false, 1));
+  %OptimizeFunctionOnNextCall(apply);
+  assertEquals(11, apply(true, 10));
+  assertEquals(9, apply(false, 10));
+})();
+
+(function CallInsideTryBlock() {
+  function ok(x) { return x; }
+  function fail(x) { throw x; }
+  function call(good, x) {
+    var f = good ? ok : fail;
+    try {
+      return f(x);
+    } catch (e) {
+      return -e;
+    }
+  }
+  assertEquals(1, call(true, 1));
+  assertEquals(-1, call(false, 1));
+  %OptimizeFunctionOnNextCall(call);
+  assertEquals(2, call(true, 2));
+  assertEquals(-2, call(false, 2));
+})();
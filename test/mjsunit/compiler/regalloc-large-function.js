@@ -0,0 +1,48 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo
+// Flags: --turbo-fast-register-allocation-threshold=200
+
+(function StraightLineArithmetic() {
+  // Many values that stay live until the very end.
+  var n = 64;
+  var body = "";
+  for (var i = 0; i < n; i++) {
+    body += "var v" + i + " = (x * " + (i + 1) + " + y) | 0;\n";
+  }
+  body += "return 0";
+  for (var i = 0; i < n; i++) body += " + v" + i;
+  body += ";";
+  var f = new Function("x", "y", body);
+  function expected(x, y) {
+    var sum = 0;
+    for (var i = 0; i < n; i++) sum += (x * (i + 1) + y) | 0;
+    return sum;
+  }
+  assertEquals(expected(1, 2), f(1, 2));
+  assertEquals(expected(3, 4), f(3, 4));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected(5, 6), f(5, 6));
+  assertEquals(expected(-7, 8), f(-7, 8));
+})();
+
+(function StateMachine() {
+  // A transpiled state machine with values live across a big switch.
+  var n = 32;
+  var body = "var state = 0, a = 0, b = 1;\n" +
+             "while (state >= 0) {\n" +
+             "  switch (state) {\n";
+  for (var i = 0; i < n; i++) {
+    body += "    case " + i + ": a = (a + b * " + i + ") | 0; " +
+            "b = (b ^ a) | 0; state = " + (i + 1 < n ? i + 1 : -1) +
+            "; break;\n";
+  }
+  body += "  }\n}\nreturn a + b + x;";
+  var f = new Function("x", body);
+  var expected = f(0);
+  assertEquals(expected + 1, f(1));
+  %OptimizeFunctionOnNextCall(f);
+  assertEquals(expected + 2, f(2));
+})();
@@ -0,0 +1,30 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition
+
+// Arrays cloned from a literal boilerplate by the interpreter report
+// elements kind transitions back to their AllocationSite.
+
+(function SmiToDouble() {
+  function make() { return [1, 2, 3]; }
+  make();  // Creates the AllocationSite and boilerplate.
+  var a = make();
+  assertTrue(%HasFastSmiElements(a));
+  a[0] = 1.5;
+  assertTrue(%HasFastDoubleElements(a));
+  var b = make();
+  assertTrue(%HasFastDoubleElements(b));
+  assertEquals([1, 2, 3], b);
+})();
+
+(function SmiToObject() {
+  function make() { return [1, 2, 3]; }
+  make();
+  var a = make();
+  a[1] = "two";
+  var b = make();
+  assertTrue(%HasFastObjectElements(b));
+  assertEquals([1, 2, 3], b);
+})();
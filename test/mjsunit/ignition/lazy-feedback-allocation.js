@@ -0,0 +1,58 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --lazy-feedback-allocation
+// Flags: --feedback-allocation-budget=3
+
+// Top-level code runs once, so it never gets a feedback vector.
+var global_var = 1;
+function global_function() { return global_var + 1; }
+let script_let = 3;
+assertEquals(2, global_function());
+assertEquals("undefined", typeof not_defined_anywhere);
+assertThrows(function() { return not_defined_anywhere; }, ReferenceError);
+
+function properties(o, key) {
+  o.x = o.y + 1;
+  o[key] = o[key + "_source"];
+  return o.x + o[key];
+}
+
+function calls(f, a) {
+  return f(a) + f.call(null, a);
+}
+
+function globals() {
+  global_var = global_var + script_let;
+  return global_function();
+}
+
+function forIn(o) {
+  var keys = [];
+  for (var key in o) keys.push(key);
+  return keys.join();
+}
+
+function tdz() {
+  return later_let;
+}
+
+// Run each function past its allocation budget.
+for (var i = 0; i < 5; i++) {
+  assertEquals(4, properties({y: 1, z_source: 2}, "z"));
+  assertEquals(2 * (i + 1), calls(function(a) { return a + 1; }, i));
+  assertEquals(global_var + script_let + 1, globals());
+  assertEquals("a,b", forIn({a: 1, b: 2}));
+  assertEquals("0,c", forIn(new Proxy({0: 1, c: 2}, {})));
+  assertThrows(tdz, ReferenceError);
+}
+let later_let = 5;
+assertEquals(5, tdz());
+
+// Optimizing a function allocates its vector on the spot.
+function optimized(o) { return o.a + o.b; }
+assertEquals(3, optimized({a: 1, b: 2}));
+%OptimizeFunctionOnNextCall(optimized);
+assertEquals(3, optimized({a: 1, b: 2}));
+assertEquals(7, optimized({a: 3, b: 4}));
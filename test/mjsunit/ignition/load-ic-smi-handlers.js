@@ -0,0 +1,46 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --tf-load-ic-stub
+
+// Monomorphic named loads in Ignition only inline field handlers; constant
+// handlers have to go through the LoadIC.
+
+function f0() { return 0; }
+function f1() { return 1; }
+
+(function ConstantAtFirstDescriptor() {
+  function load(o) { return o.m; }
+  var o = { m: f0 };
+  for (var i = 0; i < 5; i++) assertSame(f0, load(o));
+  var p = { m: f1 };  // Same map, but m is a different constant.
+  assertSame(f1, load(p));
+  assertSame(f0, load(o));
+})();
+
+(function ConstantAtLaterDescriptor() {
+  function load(o) { return o.m; }
+  var o = { a: 1, b: "two", m: f0 };
+  for (var i = 0; i < 5; i++) assertSame(f0, load(o));
+})();
+
+(function InobjectAndOutOfObjectFields() {
+  function load_a(o) { return o.a; }
+  function load_z(o) { return o.z; }
+  var o = { a: "in-object" };
+  for (var i = 0; i < 20; i++) o["p" + i] = i;
+  o.z = "out-of-object";
+  for (var i = 0; i < 5; i++) {
+    assertEquals("in-object", load_a(o));
+    assertEquals("out-of-object", load_z(o));
+  }
+})();
+
+(function DoubleField() {
+  function load(o) { return o.d; }
+  var o = { d: 1.5 };
+  for (var i = 0; i < 5; i++) assertEquals(1.5, load(o));
+  o.d = 2.5;
+  assertEquals(2.5, load(o));
+})();
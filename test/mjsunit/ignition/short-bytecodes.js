@@ -0,0 +1,80 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --ignition --ignition-short-bytecodes
+// Flags: --turbo-from-bytecode
+
+// Locals live in r0..r15 and beyond, so loads and stores use both the
+// short-form Ldar/Star bytecodes and the ones with a register operand.
+function ManyLocals(x) {
+  var a0 = x, a1 = a0 + 1, a2 = a1 + 1, a3 = a2 + 1, a4 = a3 + 1;
+  var a5 = a4 + 1, a6 = a5 + 1, a7 = a6 + 1, a8 = a7 + 1, a9 = a8 + 1;
+  var a10 = a9 + 1, a11 = a10 + 1, a12 = a11 + 1, a13 = a12 + 1;
+  var a14 = a13 + 1, a15 = a14 + 1, a16 = a15 + 1, a17 = a16 + 1;
+  var t = a17;
+  a17 = a0; a0 = t;
+  return [a0, a1, a2, a3, a4, a5, a6, a7, a8, a9, a10, a11, a12, a13, a14,
+          a15, a16, a17];
+}
+
+function Expected(x) {
+  var result = [];
+  for (var i = 0; i < 18; i++) result.push(x + i);
+  var t = result[17];
+  result[17] = result[0];
+  result[0] = t;
+  return result;
+}
+
+assertEquals(Expected(0), ManyLocals(0));
+assertEquals(Expected(10), ManyLocals(10));
+%OptimizeFunctionOnNextCall(ManyLocals);
+assertEquals(Expected(20), ManyLocals(20));
+assertEquals(Expected(-5), ManyLocals(-5));
+
+// Stores followed by dispatch to the next bytecode inside loops.
+function Loop(n) {
+  var sum = 0, prev = 0, cur = 1;
+  for (var i = 0; i < n; i++) {
+    var next = prev + cur;
+    prev = cur;
+    cur = next;
+    sum += prev;
+  }
+  return sum;
+}
+
+assertEquals(143, Loop(10));
+assertEquals(143, Loop(10));
+%OptimizeFunctionOnNextCall(Loop);
+assertEquals(143, Loop(10));
+assertEquals(17710, Loop(20));
+
+// Registers that survive an exception and a generator suspension.
+function TryCatch(x) {
+  var a = x, b = x * 2, c;
+  try {
+    c = a + b;
+    throw c;
+  } catch (e) {
+    c = e + a;
+  }
+  return c;
+}
+
+assertEquals(4, TryCatch(1));
+assertEquals(4, TryCatch(1));
+%OptimizeFunctionOnNextCall(TryCatch);
+assertEquals(8, TryCatch(2));
+
+function* Generator(x) {
+  var a = x, b = a + 1;
+  var c = yield a;
+  yield b + c;
+}
+
+var g = Generator(1);
+assertEquals(1, g.next().value);
+assertEquals(12, g.next(10).value);
+assertTrue(g.next().done);
@@ -0,0 +1,65 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+(function MixedShapesShareMaps() {
+  // The transition tree forks after "id", so the parser cannot rely on a
+  // single expected transition for the second key.
+  var json = '[' +
+      '{"id":1,"a":1,"b":"x"},{"id":2,"c":2},' +
+      '{"id":3,"a":3,"b":"y"},{"id":4,"c":4},' +
+      '{"id":5,"a":5,"b":"z"},{"id":6,"c":6}]';
+  var list = JSON.parse(json);
+  assertEquals(6, list.length);
+  assertEquals({id: 5, a: 5, b: "z"}, list[4]);
+  assertEquals({id: 6, c: 6}, list[5]);
+  assertTrue(%HaveSameMap(list[0], list[2]));
+  assertTrue(%HaveSameMap(list[0], list[4]));
+  assertTrue(%HaveSameMap(list[1], list[3]));
+  assertTrue(%HaveSameMap(list[1], list[5]));
+  assertFalse(%HaveSameMap(list[0], list[1]));
+})();
+
+(function PrefixKeysDoNotMatch() {
+  var list = JSON.parse(
+      '[{"k":1,"ab":1},{"k":2,"abc":2},{"k":3,"ab":3},{"k":4,"a":4}]');
+  assertEquals({k: 1, ab: 1}, list[0]);
+  assertEquals({k: 2, abc: 2}, list[1]);
+  assertEquals({k: 3, ab: 3}, list[2]);
+  assertEquals({k: 4, a: 4}, list[3]);
+})();
+
+(function RepresentationChanges() {
+  var list = JSON.parse(
+      '[{"p":0,"q":1,"r":2},{"p":0,"s":1},{"p":0,"q":1.5,"r":2},' +
+      '{"p":0,"q":"str","r":[]},{"p":0,"q":{},"r":null},{"p":0,"s":2}]');
+  assertEquals(1, list[0].q);
+  assertEquals(1.5, list[2].q);
+  assertEquals("str", list[3].q);
+  assertEquals([], list[3].r);
+  assertEquals({}, list[4].q);
+  assertEquals(null, list[4].r);
+  assertEquals({p: 0, s: 2}, list[5]);
+})();
+
+(function LongStrings() {
+  var plain = "";
+  for (var i = 0; i < 100; i++) plain += "abcdefghijé";
+  assertEquals(plain, JSON.parse(JSON.stringify(plain)));
+  // Special characters at every offset within a machine word.
+  for (var i = 0; i < 20; i++) {
+    var prefix = plain.substring(0, i);
+    assertEquals(prefix + '"' + plain,
+                 JSON.parse('"' + prefix + '\\"' + plain + '"'));
+    assertEquals(prefix + '\\' + plain,
+                 JSON.parse('"' + prefix + '\\\\' + plain + '"'));
+    assertThrows(function() {
+      JSON.parse('"' + prefix + '\n' + plain + '"');
+    }, SyntaxError);
+    assertThrows(function() {
+      JSON.parse('"' + plain + prefix);
+    }, SyntaxError);
+  }
+})();
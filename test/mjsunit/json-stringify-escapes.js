@@ -0,0 +1,31 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Characters that need escaping at every offset within a machine word of a
+// longer one-byte string.
+
+var plain = "";
+for (var i = 0; i < 10; i++) plain += "abc def!é\x7f";
+
+var escapes = {
+  '"': '\\"', '\\': '\\\\', '\n': '\\n', '\x00': '\\u0000', '\x1f': '\\u001f'
+};
+
+for (var c in escapes) {
+  for (var i = 0; i < 20; i++) {
+    var prefix = plain.substring(0, i);
+    var expected = '"' + prefix + escapes[c] + plain + escapes[c] + '"';
+    assertEquals(expected, JSON.stringify(prefix + c + plain + c));
+    assertEquals(prefix + c + plain,
+                 JSON.parse(JSON.stringify(prefix + c + plain)));
+  }
+}
+
+assertEquals('"' + plain + '"', JSON.stringify(plain));
+
+var record = {};
+record[plain] = plain;
+record['key"' + plain] = 1;
+assertEquals('{"' + plain + '":"' + plain + '","key\\"' + plain + '":1}',
+             JSON.stringify(record));
@@ -0,0 +1,66 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --tf-load-ic-stub
+
+function f0() { return 0; }
+function f1() { return 1; }
+function f2() { return 2; }
+
+(function MonomorphicConstant() {
+  function load(o) { return o.m; }
+  var o = { m: f0 };
+  for (var i = 0; i < 5; i++) assertSame(f0, load(o));
+  var p = { m: f1 };  // Same map, but m is a different constant.
+  assertSame(f1, load(p));
+  assertSame(f0, load(o));
+})();
+
+(function PolymorphicFieldsAndConstants() {
+  function load(o) { return o.m; }
+  var objects = [
+    { m: f0 },
+    { a: 1, m: f1 },
+    { m: 1.5 },
+    { a: 1, b: 2, m: "field" },
+  ];
+  var expected = [f0, f1, 1.5, "field"];
+  for (var j = 0; j < 5; j++) {
+    for (var i = 0; i < objects.length; i++) {
+      assertSame(expected[i], load(objects[i]));
+    }
+  }
+  %OptimizeFunctionOnNextCall(load);
+  for (var i = 0; i < objects.length; i++) {
+    assertSame(expected[i], load(objects[i]));
+  }
+})();
+
+(function MegamorphicConstants() {
+  function load(o) { return o.m; }
+  var objects = [];
+  for (var i = 0; i < 10; i++) {
+    var o = {};
+    o["x" + i] = i;
+    o.m = i & 1 ? f1 : f2;
+    objects.push(o);
+  }
+  for (var j = 0; j < 3; j++) {
+    for (var i = 0; i < objects.length; i++) {
+      assertSame(i & 1 ? f1 : f2, load(objects[i]));
+    }
+  }
+})();
+
+(function KeyedConstant() {
+  function load(o, key) { return o[key]; }
+  var o = { m: f0, n: f1 };
+  for (var i = 0; i < 5; i++) {
+    assertSame(f0, load(o, "m"));
+    assertSame(f1, load(o, "n"));
+  }
+  o.m = f2;  // Turns the constant into a field.
+  assertSame(f2, load(o, "m"));
+  assertSame(f1, load(o, "n"));
+})();
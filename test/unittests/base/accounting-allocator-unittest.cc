@@ -0,0 +1,172 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/base/accounting-allocator.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace base {
+
+namespace {
+
+const size_t kSegmentSize = 64 * 1024;
+
+}  // namespace
+
+
+TEST(AccountingAllocator, AccountsMemoryUsage) {
+  AccountingAllocator allocator;
+  void* a = allocator.Allocate(100);
+  void* b = allocator.Allocate(200);
+  ASSERT_NE(nullptr, a);
+  ASSERT_NE(nullptr, b);
+  EXPECT_EQ(300U, allocator.GetCurrentMemoryUsage());
+  allocator.Free(a, 100);
+  EXPECT_EQ(200U, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(300U, allocator.GetMaxMemoryUsage());
+  allocator.Free(b, 200);
+  EXPECT_EQ(0U, allocator.GetCurrentMemoryUsage());
+}
+
+
+TEST(AccountingAllocator, SegmentPoolDisabledByDefault) {
+  AccountingAllocator allocator;
+  void* segment = allocator.GetSegment(kSegmentSize);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment, kSegmentSize);
+  EXPECT_EQ(0U, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0U, allocator.GetCurrentPoolSize());
+}
+
+
+TEST(AccountingAllocator, SegmentPoolRecyclesSegments) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(64 * kSegmentSize);
+  void* segment = allocator.GetSegment(kSegmentSize);
+  ASSERT_NE(nullptr, segment);
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentMemoryUsage());
+  allocator.ReturnSegment(segment, kSegmentSize);
+  EXPECT_EQ(0U, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(segment, allocator.GetSegment(kSegmentSize));
+  EXPECT_EQ(kSegmentSize, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0U, allocator.GetCurrentPoolSize());
+  allocator.ReturnSegment(segment, kSegmentSize);
+}
+
+
+TEST(AccountingAllocator, SegmentPoolIgnoresOtherSizes) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(64 * kSegmentSize);
+  const size_t kOddSize = kSegmentSize + 8;
+  void* segment = allocator.GetSegment(kOddSize);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment, kOddSize);
+  EXPECT_EQ(0U, allocator.GetCurrentPoolSize());
+  const size_t kHugeSize = 2 * AccountingAllocator::kMaxPooledSegmentSize;
+  segment = allocator.GetSegment(kHugeSize);
+  ASSERT_NE(nullptr, segment);
+  allocator.ReturnSegment(segment, kHugeSize);
+  EXPECT_EQ(0U, allocator.GetCurrentPoolSize());
+}
+
+
+TEST(AccountingAllocator, SegmentPoolIsBounded) {
+  AccountingAllocator allocator;
+  // Room for two segments of kSegmentSize.
+  allocator.ConfigureSegmentPool(AccountingAllocator::kNumberOfPoolBuckets *
+                                 2 * kSegmentSize);
+  void* segments[4];
+  for (size_t i = 0; i < arraysize(segments); ++i) {
+    segments[i] = allocator.GetSegment(kSegmentSize);
+    ASSERT_NE(nullptr, segments[i]);
+  }
+  for (size_t i = 0; i < arraysize(segments); ++i) {
+    allocator.ReturnSegment(segments[i], kSegmentSize);
+  }
+  EXPECT_EQ(2 * kSegmentSize, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(0U, allocator.GetCurrentMemoryUsage());
+}
+
+
+TEST(AccountingAllocator, SegmentPoolDecaysAndClears) {
+  AccountingAllocator allocator;
+  allocator.ConfigureSegmentPool(64 * kSegmentSize);
+  void* segments[4];
+  for (size_t i = 0; i < arraysize(segments); ++i) {
+    segments[i] = allocator.GetSegment(kSegmentSize);
+    ASSERT_NE(nullptr, segments[i]);
+  }
+  for (size_t i = 0; i < arraysize(segments); ++i) {
+    allocator.ReturnSegment(segments[i], kSegmentSize);
+  }
+  EXPECT_EQ(4 * kSegmentSize, allocator.GetCurrentPoolSize());
+  allocator.DecaySegmentPool();
+  EXPECT_EQ(2 * kSegmentSize, allocator.GetCurrentPoolSize());
+  allocator.ClearSegmentPool();
+  EXPECT_EQ(0U, allocator.GetCurrentPoolSize());
+}
+
+
+namespace {
+
+class CountingAllocator : public AccountingAllocator {
+ public:
+  ~CountingAllocator() override { ClearSegmentPool(); }
+
+  void Free(void* memory, size_t bytes) override {
+    AccountingAllocator::Free(memory, bytes);
+    freed += bytes;
+  }
+
+  size_t reused = 0;
+  size_t pooled = 0;
+  size_t freed = 0;
+
+ protected:
+  void OnSegmentReused(size_t bytes) override { reused += bytes; }
+  void OnSegmentPooled(size_t bytes) override { pooled += bytes; }
+};
+
+}  // namespace
+
+
+TEST(AccountingAllocator, SegmentPoolNotifiesSubclasses) {
+  CountingAllocator allocator;
+  allocator.ConfigureSegmentPool(64 * kSegmentSize);
+  void* segment = allocator.GetSegment(kSegmentSize);
+  ASSERT_NE(nullptr, segment);
+  EXPECT_EQ(0U, allocator.reused);
+  allocator.ReturnSegment(segment, kSegmentSize);
+  EXPECT_EQ(kSegmentSize, allocator.pooled);
+  segment = allocator.GetSegment(kSegmentSize);
+  EXPECT_EQ(kSegmentSize, allocator.reused);
+  allocator.ReturnSegment(segment, kSegmentSize);
+  EXPECT_EQ(2 * kSegmentSize, allocator.pooled);
+}
+
+
+TEST(AccountingAllocator, SegmentPoolFreesThroughSubclasses) {
+  CountingAllocator allocator;
+  allocator.ConfigureSegmentPool(64 * kSegmentSize);
+  void* segments[4];
+  for (size_t i = 0; i < arraysize(segments); ++i) {
+    segments[i] = allocator.GetSegment(kSegmentSize);
+    ASSERT_NE(nullptr, segments[i]);
+  }
+  for (size_t i = 0; i < arraysize(segments); ++i) {
+    allocator.ReturnSegment(segments[i], kSegmentSize);
+  }
+  EXPECT_EQ(0U, allocator.freed);
+  allocator.DecaySegmentPool();
+  EXPECT_EQ(2 * kSegmentSize, allocator.freed);
+  allocator.ClearSegmentPool();
+  EXPECT_EQ(4 * kSegmentSize, allocator.freed);
+  EXPECT_EQ(0U, allocator.GetCurrentMemoryUsage());
+  EXPECT_EQ(0U, allocator.GetCurrentPoolSize());
+  EXPECT_EQ(4 * kSegmentSize, allocator.GetMaxMemoryUsage());
+}
+
+}  // namespace base
+}  // namespace v8
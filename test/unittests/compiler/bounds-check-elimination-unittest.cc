@@ -0,0 +1,188 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/bounds-check-elimination.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "src/types.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class BoundsCheckEliminationTest : public TypedGraphTest {
+ public:
+  BoundsCheckEliminationTest() : TypedGraphTest(3), simplified_(zone()) {}
+  ~BoundsCheckEliminationTest() override {}
+
+ protected:
+  Reduction Reduce(Node* node) {
+    MachineOperatorBuilder machine(zone());
+    JSOperatorBuilder javascript(zone());
+    JSGraph jsgraph(isolate(), graph(), common(), &javascript, simplified(),
+                    &machine);
+    GraphReducer graph_reducer(zone(), graph());
+    BoundsCheckElimination reducer(&graph_reducer, &jsgraph);
+    return reducer.Reduce(node);
+  }
+
+  // Returns the control projection for the {polarity} of a branch on
+  // {condition}.
+  Node* Dominate(Node* condition, bool polarity) {
+    Node* branch = graph()->NewNode(common()->Branch(), condition, start());
+    return polarity ? graph()->NewNode(common()->IfTrue(), branch)
+                    : graph()->NewNode(common()->IfFalse(), branch);
+  }
+
+  Node* CheckBounds(Node* index, Node* length, Node* control) {
+    return graph()->NewNode(simplified()->CheckBounds(), index, length,
+                            start(), control);
+  }
+
+  Type* IndexType() { return Type::Range(0.0, 4294967295.0, zone()); }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+// -----------------------------------------------------------------------------
+// CheckBounds
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsWithIndexBelowLength) {
+  Node* index = Parameter(Type::Range(0.0, 9.0, zone()), 0);
+  Node* length = Parameter(Type::Range(10.0, 20.0, zone()), 1);
+  Reduction r = Reduce(CheckBounds(index, length, start()));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(index, r.replacement());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsWithIndexNotBelowLength) {
+  Node* index = Parameter(Type::Range(0.0, 10.0, zone()), 0);
+  Node* length = Parameter(Type::Range(10.0, 20.0, zone()), 1);
+  Reduction r = Reduce(CheckBounds(index, length, start()));
+  ASSERT_FALSE(r.Changed());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsDominatedByLessThan) {
+  Node* index = Parameter(IndexType(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* control = Dominate(
+      graph()->NewNode(simplified()->NumberLessThan(), index, length), true);
+  Reduction r = Reduce(CheckBounds(index, length, control));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(index, r.replacement());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsDominatedByLessThanConstant) {
+  Node* index = Parameter(IndexType(), 0);
+  Node* length = Parameter(Type::Range(100.0, 200.0, zone()), 1);
+  Node* control = Dominate(graph()->NewNode(simplified()->NumberLessThan(),
+                                            index, NumberConstant(100.0)),
+                           true);
+  Reduction r = Reduce(CheckBounds(index, length, control));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(index, r.replacement());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsDominatedByLessThanOrEqual) {
+  Node* index = Parameter(IndexType(), 0);
+  Node* length = Parameter(Type::Range(0.0, 1000.0, zone()), 1);
+  Node* control = Dominate(
+      graph()->NewNode(simplified()->NumberLessThanOrEqual(), length, index),
+      false);
+  Reduction r = Reduce(CheckBounds(index, length, control));
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(index, r.replacement());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsOnFalseBranchOfLessThan) {
+  Node* index = Parameter(IndexType(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* control = Dominate(
+      graph()->NewNode(simplified()->NumberLessThan(), index, length), false);
+  Reduction r = Reduce(CheckBounds(index, length, control));
+  ASSERT_FALSE(r.Changed());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsWithNegativeIndex) {
+  Node* index = Parameter(Type::Range(-1.0, 10.0, zone()), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* control = Dominate(
+      graph()->NewNode(simplified()->NumberLessThan(), index, length), true);
+  Reduction r = Reduce(CheckBounds(index, length, control));
+  ASSERT_FALSE(r.Changed());
+}
+
+TEST_F(BoundsCheckEliminationTest, CheckBoundsWithNonIntegerIndex) {
+  Node* index = Parameter(Type::PlainNumber(), 0);
+  Node* length = Parameter(Type::Unsigned31(), 1);
+  Node* control = Dominate(
+      graph()->NewNode(simplified()->NumberLessThan(), index, length), true);
+  Reduction r = Reduce(CheckBounds(index, length, control));
+  ASSERT_FALSE(r.Changed());
+}
+
+// -----------------------------------------------------------------------------
+// LoadBuffer / StoreBuffer
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferDominatedByLessThan) {
+  Node* buffer = Parameter(0);
+  Node* key = Parameter(IndexType(), 1);
+  Node* offset = graph()->NewNode(simplified()->NumberShiftLeft(), key,
+                                  NumberConstant(3.0));
+  Node* control = Dominate(graph()->NewNode(simplified()->NumberLessThan(),
+                                            key, NumberConstant(100.0)),
+                           true);
+  Node* load = graph()->NewNode(
+      simplified()->LoadBuffer(BufferAccess(kExternalFloat64Array)), buffer,
+      offset, NumberConstant(800.0), start(), control);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(IrOpcode::kLoadElement, load->opcode());
+  EXPECT_EQ(buffer, NodeProperties::GetValueInput(load, 0));
+  EXPECT_EQ(key, NodeProperties::GetValueInput(load, 1));
+  EXPECT_EQ(control, NodeProperties::GetControlInput(load));
+}
+
+TEST_F(BoundsCheckEliminationTest, LoadBufferWithBoundAboveLength) {
+  Node* buffer = Parameter(0);
+  Node* key = Parameter(IndexType(), 1);
+  Node* offset = graph()->NewNode(simplified()->NumberShiftLeft(), key,
+                                  NumberConstant(3.0));
+  Node* control = Dominate(graph()->NewNode(simplified()->NumberLessThan(),
+                                            key, NumberConstant(101.0)),
+                           true);
+  Node* load = graph()->NewNode(
+      simplified()->LoadBuffer(BufferAccess(kExternalFloat64Array)), buffer,
+      offset, NumberConstant(800.0), start(), control);
+  Reduction r = Reduce(load);
+  ASSERT_FALSE(r.Changed());
+}
+
+TEST_F(BoundsCheckEliminationTest, StoreBufferDominatedByLessThan) {
+  Node* buffer = Parameter(0);
+  Node* key = Parameter(IndexType(), 1);
+  Node* value = Parameter(Type::Unsigned31(), 2);
+  Node* control = Dominate(graph()->NewNode(simplified()->NumberLessThan(),
+                                            key, NumberConstant(100.0)),
+                           true);
+  Node* store = graph()->NewNode(
+      simplified()->StoreBuffer(BufferAccess(kExternalUint8Array)), buffer, key,
+      NumberConstant(100.0), value, start(), control);
+  Reduction r = Reduce(store);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(IrOpcode::kStoreElement, store->opcode());
+  EXPECT_EQ(key, NodeProperties::GetValueInput(store, 1));
+  EXPECT_EQ(value, NodeProperties::GetValueInput(store, 2));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -80,6 +80,26 @@ TEST_F(GraphTrimmerTest, Roots) {
   EXPECT_THAT(graph()->start()->uses(), UnorderedElementsAre(live0, live1));
 }
 
+
+TEST_F(GraphTrimmerTest, RenumberLiveNodes) {
+  Node* const dead0 = graph()->NewNode(&kDead0, graph()->start());
+  Node* const live0 = graph()->NewNode(&kLive0, graph()->start());
+  Node* const dead1 = graph()->NewNode(&kDead0, live0);
+  graph()->SetEnd(graph()->NewNode(common()->End(1), live0));
+  GraphTrimmer trimmer(zone(), graph());
+  trimmer.TrimGraph();
+  EXPECT_THAT(trimmer.live(),
+              ElementsAre(graph()->end(), live0, graph()->start()));
+  graph()->RenumberNodes(trimmer.live());
+  EXPECT_EQ(3u, graph()->NodeCount());
+  EXPECT_EQ(0u, graph()->end()->id());
+  EXPECT_EQ(1u, live0->id());
+  EXPECT_EQ(2u, graph()->start()->id());
+  EXPECT_EQ(3u, graph()->NewNode(&kLive0, graph()->start())->id());
+  EXPECT_THAT(dead0->inputs(), ElementsAre(nullptr));
+  EXPECT_THAT(dead1->inputs(), ElementsAre(nullptr));
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
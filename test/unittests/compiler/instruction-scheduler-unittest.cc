@@ -0,0 +1,137 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <vector>
+
+#include "src/compiler/instruction-scheduler.h"
+#include "src/compiler/instruction.h"
+#include "src/register-configuration.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class InstructionSchedulerTest : public TestWithIsolateAndZone {
+ public:
+  InstructionSchedulerTest()
+      : blocks_(zone()),
+        sequence_(isolate(), zone(), &blocks_),
+        scheduler_(zone(), &sequence_) {
+    blocks_.push_back(new (zone()) InstructionBlock(
+        zone(), RpoNumber::FromInt(0), RpoNumber::Invalid(),
+        RpoNumber::Invalid(), false, false));
+  }
+  ~InstructionSchedulerTest() override {}
+
+ protected:
+  InstructionScheduler* scheduler() { return &scheduler_; }
+
+  void StartBlock() { scheduler()->StartBlock(RpoNumber::FromInt(0)); }
+  void EndBlock() { scheduler()->EndBlock(RpoNumber::FromInt(0)); }
+
+  // Adds an instruction defining a new general or FP value and returns it.
+  Instruction* Define(bool fp) {
+    int vreg = sequence_.NextVirtualRegister();
+    if (fp) {
+      sequence_.MarkAsRepresentation(MachineRepresentation::kFloat64, vreg);
+    }
+    InstructionOperand output =
+        UnallocatedOperand(UnallocatedOperand::MUST_HAVE_REGISTER, vreg);
+    Instruction* instr =
+        Instruction::New(zone(), kArchNop, 1, &output, 0, nullptr, 0, nullptr);
+    scheduler()->AddInstruction(instr);
+    return instr;
+  }
+
+  // Adds an instruction reading the value defined by {def} and returns it.
+  Instruction* Use(Instruction* def) {
+    InstructionOperand input = UnallocatedOperand(
+        UnallocatedOperand::ANY,
+        UnallocatedOperand::cast(def->OutputAt(0))->virtual_register());
+    Instruction* instr =
+        Instruction::New(zone(), kArchNop, 0, nullptr, 1, &input, 0, nullptr);
+    scheduler()->AddInstruction(instr);
+    return instr;
+  }
+
+  // Returns the position of {instr} in the scheduled block.
+  int PositionOf(Instruction* instr) {
+    for (int i = 0; i < static_cast<int>(sequence_.instructions().size());
+         ++i) {
+      if (sequence_.InstructionAt(i) == instr) return i;
+    }
+    return -1;
+  }
+
+ private:
+  InstructionBlocks blocks_;
+  InstructionSequence sequence_;
+  InstructionScheduler scheduler_;
+};
+
+namespace {
+
+int GeneralRegisterCount() {
+  return RegisterConfiguration::Turbofan()
+      ->num_allocatable_general_registers();
+}
+
+int FPRegisterCount() {
+  return RegisterConfiguration::Turbofan()->num_allocatable_double_registers();
+}
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Register pressure
+
+// The tests define one value per allocatable register of one class and three
+// values of the other class, then use all of them in the same order. Once
+// every register of the first class holds a value, the scheduler frees one of
+// them before it goes on with the values of the other class, which don't add
+// to the pressure on the first.
+TEST_F(InstructionSchedulerTest, FPValuesDoNotAddToGeneralPressure) {
+  if (!InstructionScheduler::SchedulerSupported()) return;
+  int const count = GeneralRegisterCount();
+  std::vector<Instruction*> general_defs, fp_defs, general_uses;
+
+  StartBlock();
+  for (int i = 0; i < count; ++i) general_defs.push_back(Define(false));
+  for (int i = 0; i < 3; ++i) fp_defs.push_back(Define(true));
+  for (Instruction* def : general_defs) general_uses.push_back(Use(def));
+  for (Instruction* def : fp_defs) Use(def);
+  EndBlock();
+
+  for (int i = 0; i < count; ++i) EXPECT_EQ(i, PositionOf(general_defs[i]));
+  EXPECT_EQ(count, PositionOf(general_uses[0]));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(count + 1 + i, PositionOf(fp_defs[i]));
+  }
+  EXPECT_EQ(count + 4, PositionOf(general_uses[1]));
+}
+
+TEST_F(InstructionSchedulerTest, GeneralValuesDoNotAddToFPPressure) {
+  if (!InstructionScheduler::SchedulerSupported()) return;
+  int const count = FPRegisterCount();
+  std::vector<Instruction*> fp_defs, general_defs, fp_uses;
+
+  StartBlock();
+  for (int i = 0; i < count; ++i) fp_defs.push_back(Define(true));
+  for (int i = 0; i < 3; ++i) general_defs.push_back(Define(false));
+  for (Instruction* def : fp_defs) fp_uses.push_back(Use(def));
+  for (Instruction* def : general_defs) Use(def);
+  EndBlock();
+
+  for (int i = 0; i < count; ++i) EXPECT_EQ(i, PositionOf(fp_defs[i]));
+  EXPECT_EQ(count, PositionOf(fp_uses[0]));
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_EQ(count + 1 + i, PositionOf(general_defs[i]));
+  }
+  EXPECT_EQ(count + 4, PositionOf(fp_uses[1]));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,226 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-invariant-code-motion.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/operator.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// A helper for building loops with a single effect phi.
+struct LoopNodes {
+  Node* loop;
+  Node* effect_phi;
+};
+
+class LoopInvariantCodeMotionTest : public GraphTest {
+ public:
+  LoopInvariantCodeMotionTest() : GraphTest(3), simplified_(zone()) {}
+  ~LoopInvariantCodeMotionTest() override {}
+
+ protected:
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  Node* LoadMap(Node* object, Node* effect, Node* control) {
+    return graph()->NewNode(simplified()->LoadField(AccessBuilder::ForMap()),
+                            object, effect, control);
+  }
+
+  LoopNodes NewLoop(Node* effect, Node* control) {
+    LoopNodes l;
+    l.loop = graph()->NewNode(common()->Loop(2), control, control);
+    l.effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), effect, effect, l.loop);
+    return l;
+  }
+
+  // Closes {l} with a branch on {cond}, taking {effect} around the back edge,
+  // and returns {value} once the loop is done.
+  void CloseLoop(LoopNodes const& l, Node* cond, Node* effect, Node* value) {
+    Node* branch = graph()->NewNode(common()->Branch(), cond, l.loop);
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    l.loop->ReplaceInput(1, if_true);
+    l.effect_phi->ReplaceInput(1, effect);
+    Node* ret =
+        graph()->NewNode(common()->Return(), value, l.effect_phi, if_false);
+    graph()->SetEnd(ret);
+  }
+
+  void RunLoopInvariantCodeMotion() {
+    Zone zone(isolate()->allocator());
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), &zone);
+    LoopInvariantCodeMotion licm(loop_tree, &zone);
+    licm.Run();
+  }
+
+  void ExpectHoisted(LoopNodes const& l, Node* node, Node* effect,
+                     Node* control) {
+    EXPECT_EQ(effect, NodeProperties::GetEffectInput(node));
+    EXPECT_EQ(control, NodeProperties::GetControlInput(node));
+    EXPECT_EQ(node, l.effect_phi->InputAt(0));
+  }
+
+  void ExpectNotHoisted(LoopNodes const& l, Node* node) {
+    EXPECT_EQ(l.loop, NodeProperties::GetControlInput(node));
+  }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+};
+
+namespace {
+
+const Operator kOpCall(0, Operator::kNoProperties, "Call", 0, 1, 1, 0, 1, 0);
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Loads
+
+TEST_F(LoopInvariantCodeMotionTest, HoistLoadField) {
+  Node* object = Parameter(0);
+  LoopNodes l = NewLoop(start(), start());
+  Node* load = LoadMap(object, l.effect_phi, l.loop);
+  CloseLoop(l, Parameter(1), load, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectHoisted(l, load, start(), start());
+  EXPECT_EQ(l.effect_phi, l.effect_phi->InputAt(1));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, HoistLoadFieldAcrossUnrelatedStore) {
+  Node* object = Parameter(0);
+  LoopNodes l = NewLoop(start(), start());
+  Node* load = LoadMap(object, l.effect_phi, l.loop);
+  Node* store = graph()->NewNode(
+      simplified()->StoreField(AccessBuilder::ForJSObjectElements()), object,
+      Parameter(2), load, l.loop);
+  CloseLoop(l, Parameter(1), store, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectHoisted(l, load, start(), start());
+  EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(store));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, HoistLoadFieldAcrossStoreToAllocation) {
+  Node* object = Parameter(0);
+  LoopNodes l = NewLoop(start(), start());
+  Node* load = LoadMap(object, l.effect_phi, l.loop);
+  Node* allocate = graph()->NewNode(simplified()->Allocate(),
+                                    NumberConstant(16), load, l.loop);
+  Node* store =
+      graph()->NewNode(simplified()->StoreField(AccessBuilder::ForMap()),
+                       allocate, load, allocate, l.loop);
+  CloseLoop(l, Parameter(1), store, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectHoisted(l, load, start(), start());
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepLoadFieldKilledByStore) {
+  Node* object = Parameter(0);
+  LoopNodes l = NewLoop(start(), start());
+  Node* load = LoadMap(object, l.effect_phi, l.loop);
+  Node* store =
+      graph()->NewNode(simplified()->StoreField(AccessBuilder::ForMap()),
+                       Parameter(2), object, load, l.loop);
+  CloseLoop(l, Parameter(1), store, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectNotHoisted(l, load);
+  EXPECT_EQ(l.effect_phi, NodeProperties::GetEffectInput(load));
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepLoadFieldAcrossCall) {
+  Node* object = Parameter(0);
+  LoopNodes l = NewLoop(start(), start());
+  Node* load = LoadMap(object, l.effect_phi, l.loop);
+  Node* call = graph()->NewNode(&kOpCall, load, l.loop);
+  CloseLoop(l, Parameter(1), call, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectNotHoisted(l, load);
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepLoadElementWithVariantIndex) {
+  Node* object = Parameter(0);
+  LoopNodes l = NewLoop(start(), start());
+  Node* index =
+      graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                       Parameter(1), Parameter(1), l.loop);
+  Node* load = graph()->NewNode(
+      simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()), object,
+      index, l.effect_phi, l.loop);
+  index->ReplaceInput(1, load);
+  CloseLoop(l, Parameter(2), load, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectNotHoisted(l, load);
+}
+
+// -----------------------------------------------------------------------------
+// Checks
+
+TEST_F(LoopInvariantCodeMotionTest, HoistCheckWithCheckpointAtEntry) {
+  Node* checkpoint = graph()->NewNode(common()->Checkpoint(),
+                                      EmptyFrameState(), start(), start());
+  LoopNodes l = NewLoop(checkpoint, start());
+  Node* check = graph()->NewNode(simplified()->CheckIf(), Parameter(0),
+                                 l.effect_phi, l.loop);
+  CloseLoop(l, Parameter(1), check, Parameter(2));
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectHoisted(l, check, checkpoint, start());
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepCheckWithoutCheckpointAtEntry) {
+  Node* call = graph()->NewNode(&kOpCall, start(), start());
+  LoopNodes l = NewLoop(call, start());
+  Node* check = graph()->NewNode(simplified()->CheckIf(), Parameter(0),
+                                 l.effect_phi, l.loop);
+  CloseLoop(l, Parameter(1), check, Parameter(2));
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectNotHoisted(l, check);
+}
+
+TEST_F(LoopInvariantCodeMotionTest, KeepLoadBehindVariantCheck) {
+  Node* object = Parameter(0);
+  Node* checkpoint = graph()->NewNode(common()->Checkpoint(),
+                                      EmptyFrameState(), start(), start());
+  LoopNodes l = NewLoop(checkpoint, start());
+  Node* cond = graph()->NewNode(common()->Phi(MachineRepresentation::kBit, 2),
+                                Parameter(1), Parameter(1), l.loop);
+  Node* check =
+      graph()->NewNode(simplified()->CheckIf(), cond, l.effect_phi, l.loop);
+  Node* load = LoadMap(object, check, l.loop);
+  cond->ReplaceInput(1, load);
+  CloseLoop(l, Parameter(2), load, load);
+
+  RunLoopInvariantCodeMotion();
+
+  ExpectNotHoisted(l, check);
+  ExpectNotHoisted(l, load);
+  EXPECT_EQ(check, NodeProperties::GetEffectInput(load));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
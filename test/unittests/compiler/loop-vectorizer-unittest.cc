@@ -0,0 +1,303 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-vectorizer.h"
+#include "src/compiler/access-builder.h"
+#include "src/compiler/common-operator.h"
+#include "src/compiler/js-graph.h"
+#include "src/compiler/js-operator.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+
+using testing::_;
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// The nodes of a counted loop for (i = i0; i < n; ++i).
+struct CountedLoop {
+  Node* loop;
+  Node* induction;
+  Node* effect_phi;
+  Node* branch;
+  Node* body;
+};
+
+class LoopVectorizerTest : public GraphTest {
+ public:
+  LoopVectorizerTest()
+      : GraphTest(3),
+        machine_(zone()),
+        javascript_(zone()),
+        simplified_(zone()),
+        jsgraph_(isolate(), graph(), common(), &javascript_, &simplified_,
+                 &machine_) {}
+  ~LoopVectorizerTest() override {}
+
+ protected:
+  JSGraph* jsgraph() { return &jsgraph_; }
+  MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  CountedLoop NewCountedLoop(Node* limit, int32_t initial = 0) {
+    CountedLoop l;
+    l.loop = graph()->NewNode(common()->Loop(2), start(), start());
+    l.induction =
+        graph()->NewNode(common()->Phi(MachineRepresentation::kWord32, 2),
+                         Int32Constant(initial), Int32Constant(initial),
+                         l.loop);
+    l.effect_phi =
+        graph()->NewNode(common()->EffectPhi(2), start(), start(), l.loop);
+    Node* cond =
+        graph()->NewNode(machine()->Int32LessThan(), l.induction, limit);
+    l.branch = graph()->NewNode(common()->Branch(), cond, l.loop);
+    l.body = graph()->NewNode(common()->IfTrue(), l.branch);
+    return l;
+  }
+
+  // Closes {l} with the {effect} of the body and returns the induction
+  // variable once the loop is done.
+  void CloseLoop(CountedLoop const& l, Node* effect) {
+    Node* if_false = graph()->NewNode(common()->IfFalse(), l.branch);
+    l.loop->ReplaceInput(1, l.body);
+    l.effect_phi->ReplaceInput(1, effect);
+    l.induction->ReplaceInput(
+        1, graph()->NewNode(machine()->Int32Add(), l.induction,
+                            Int32Constant(1)));
+    Node* ret = graph()->NewNode(common()->Return(), l.induction,
+                                 l.effect_phi, if_false);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+  }
+
+  Node* Index(CountedLoop const& l, int32_t offset) {
+    if (offset == 0) return l.induction;
+    return graph()->NewNode(machine()->Int32Add(), l.induction,
+                            Int32Constant(offset));
+  }
+
+  Node* LoadElement(ExternalArrayType type, intptr_t base, Node* index,
+                    Node* effect, Node* control) {
+    return graph()->NewNode(
+        simplified()->LoadElement(
+            AccessBuilder::ForTypedArrayElement(type, true)),
+        jsgraph()->IntPtrConstant(base), index, effect, control);
+  }
+
+  Node* StoreElement(ExternalArrayType type, intptr_t base, Node* index,
+                     Node* value, Node* effect, Node* control) {
+    return graph()->NewNode(
+        simplified()->StoreElement(
+            AccessBuilder::ForTypedArrayElement(type, true)),
+        jsgraph()->IntPtrConstant(base), index, value, effect, control);
+  }
+
+  void RunLoopVectorizer() {
+    Zone zone(isolate()->allocator());
+    LoopTree* loop_tree = LoopFinder::BuildLoopTree(graph(), &zone);
+    LoopVectorizer vectorizer(jsgraph(), loop_tree, &zone);
+    vectorizer.Run();
+  }
+
+  // The scalar loop is entered from the vector loop iff the vectorizer did
+  // its job.
+  bool IsVectorized(CountedLoop const& l) {
+    return l.loop->InputAt(0) != start();
+  }
+
+ private:
+  MachineOperatorBuilder machine_;
+  JSOperatorBuilder javascript_;
+  SimplifiedOperatorBuilder simplified_;
+  JSGraph jsgraph_;
+};
+
+namespace {
+
+const intptr_t kBase0 = 0x10000;
+const intptr_t kBase1 = 0x20000;
+
+}  // namespace
+
+// -----------------------------------------------------------------------------
+// Vectorized loops
+
+TEST_F(LoopVectorizerTest, Float32Scale) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalFloat32Array, kBase0, l.induction,
+                           l.effect_phi, l.body);
+  Node* value =
+      graph()->NewNode(machine()->Float32Mul(), load, Float32Constant(2.0f));
+  Node* store = StoreElement(kExternalFloat32Array, kBase1, l.induction, value,
+                             load, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  ASSERT_TRUE(IsVectorized(l));
+  Node* exit = l.loop->InputAt(0);
+  Node* vector_branch = NodeProperties::GetControlInput(exit);
+  Node* vector_loop = NodeProperties::GetControlInput(vector_branch);
+  Node* vector_induction = l.induction->InputAt(0);
+  Node* vector_effect_phi = l.effect_phi->InputAt(0);
+  EXPECT_THAT(exit, IsIfFalse(IsBranch(_, IsLoop(start(), _))));
+  EXPECT_THAT(vector_induction,
+              IsPhi(MachineRepresentation::kWord32, _,
+                    IsInt32Add(vector_induction, IsInt32Constant(4)),
+                    vector_loop));
+
+  Node* vector_store = vector_effect_phi->InputAt(1);
+  ASSERT_EQ(IrOpcode::kStore, vector_store->opcode());
+  EXPECT_EQ(MachineRepresentation::kSimd128,
+            StoreRepresentationOf(vector_store->op()).representation());
+  Node* vector_value = vector_store->InputAt(2);
+  ASSERT_EQ(IrOpcode::kFloat32x4Mul, vector_value->opcode());
+  EXPECT_THAT(vector_value->InputAt(0),
+              IsLoad(MachineType::Simd128(), _, _, vector_effect_phi, _));
+  EXPECT_EQ(IrOpcode::kCreateFloat32x4, vector_value->InputAt(1)->opcode());
+}
+
+TEST_F(LoopVectorizerTest, Int32ShiftWithOffset) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalInt32Array, kBase0, Index(l, 3),
+                           l.effect_phi, l.body);
+  Node* value =
+      graph()->NewNode(machine()->Word32Sar(), load, Int32Constant(33));
+  Node* store = StoreElement(kExternalInt32Array, kBase1, l.induction, value,
+                             load, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  ASSERT_TRUE(IsVectorized(l));
+  Node* vector_store = l.effect_phi->InputAt(0)->InputAt(1);
+  ASSERT_EQ(IrOpcode::kStore, vector_store->opcode());
+  Node* vector_value = vector_store->InputAt(2);
+  ASSERT_EQ(IrOpcode::kInt32x4ShiftRightByScalar, vector_value->opcode());
+  EXPECT_THAT(vector_value->InputAt(1), IsInt32Constant(1));
+}
+
+TEST_F(LoopVectorizerTest, Float32DifferenceWithConstantLimit) {
+  // for (i = 1; i < 19; ++i) b[i - 1] = a[i] - a[i - 1], after the bounds
+  // checks were eliminated against the length of 19 element arrays.
+  CountedLoop l = NewCountedLoop(Int32Constant(19), 1);
+  Node* load0 = LoadElement(kExternalFloat32Array, kBase0, l.induction,
+                            l.effect_phi, l.body);
+  Node* load1 = LoadElement(kExternalFloat32Array, kBase0, Index(l, -1),
+                            load0, l.body);
+  Node* value = graph()->NewNode(machine()->Float32Sub(), load0, load1);
+  Node* store = StoreElement(kExternalFloat32Array, kBase1, Index(l, -1),
+                             value, load1, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  ASSERT_TRUE(IsVectorized(l));
+  Node* vector_branch = NodeProperties::GetControlInput(l.loop->InputAt(0));
+  Node* vector_induction = l.induction->InputAt(0);
+  EXPECT_THAT(vector_induction->InputAt(0), IsInt32Constant(1));
+  EXPECT_THAT(
+      vector_branch->InputAt(0),
+      IsWord32And(IsInt32LessThan(vector_induction, IsInt32Constant(19)),
+                  IsUint32LessThan(IsInt32Constant(3),
+                                   IsInt32Sub(IsInt32Constant(19),
+                                              vector_induction))));
+
+  Node* vector_effect_phi = l.effect_phi->InputAt(0);
+  Node* vector_store = vector_effect_phi->InputAt(1);
+  ASSERT_EQ(IrOpcode::kStore, vector_store->opcode());
+  EXPECT_EQ(MachineRepresentation::kSimd128,
+            StoreRepresentationOf(vector_store->op()).representation());
+  Node* vector_value = vector_store->InputAt(2);
+  ASSERT_EQ(IrOpcode::kFloat32x4Sub, vector_value->opcode());
+  EXPECT_THAT(vector_value->InputAt(0),
+              IsLoad(MachineType::Simd128(), _, _, _, _));
+  EXPECT_THAT(vector_value->InputAt(1),
+              IsLoad(MachineType::Simd128(), _, _, _, _));
+}
+
+TEST_F(LoopVectorizerTest, InPlaceUpdate) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalUint32Array, kBase0, l.induction,
+                           l.effect_phi, l.body);
+  Node* value =
+      graph()->NewNode(machine()->Word32Xor(), load, Parameter(1));
+  Node* store = StoreElement(kExternalUint32Array, kBase0, l.induction, value,
+                             load, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  EXPECT_TRUE(IsVectorized(l));
+}
+
+// -----------------------------------------------------------------------------
+// Loops that must not be vectorized
+
+TEST_F(LoopVectorizerTest, OverlappingAccesses) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalInt32Array, kBase0, l.induction,
+                           l.effect_phi, l.body);
+  Node* store = StoreElement(kExternalInt32Array, kBase0, Index(l, 1), load,
+                             load, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  EXPECT_FALSE(IsVectorized(l));
+}
+
+TEST_F(LoopVectorizerTest, Float64Sequence) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalFloat32Array, kBase0, l.induction,
+                           l.effect_phi, l.body);
+  Node* x = graph()->NewNode(machine()->ChangeFloat32ToFloat64(), load);
+  Node* y = graph()->NewNode(machine()->Float64Mul(), x, Float64Constant(0.5));
+  Node* z = graph()->NewNode(machine()->Float64Add(), y, Float64Constant(0.25));
+  Node* value = graph()->NewNode(machine()->TruncateFloat64ToFloat32(), z);
+  Node* store = StoreElement(kExternalFloat32Array, kBase1, l.induction, value,
+                             load, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  EXPECT_FALSE(IsVectorized(l));
+}
+
+TEST_F(LoopVectorizerTest, Float64ArrayAccess) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalFloat64Array, kBase0, l.induction,
+                           l.effect_phi, l.body);
+  Node* store = StoreElement(kExternalFloat64Array, kBase1, l.induction, load,
+                             load, l.body);
+  CloseLoop(l, store);
+
+  RunLoopVectorizer();
+
+  EXPECT_FALSE(IsVectorized(l));
+}
+
+TEST_F(LoopVectorizerTest, ValueUsedAfterLoop) {
+  CountedLoop l = NewCountedLoop(Parameter(0));
+  Node* load = LoadElement(kExternalInt32Array, kBase0, l.induction,
+                           l.effect_phi, l.body);
+  Node* value = graph()->NewNode(machine()->Int32Add(), load, Int32Constant(1));
+  Node* store = StoreElement(kExternalInt32Array, kBase1, l.induction, value,
+                             load, l.body);
+  CloseLoop(l, store);
+  // Keep the last value alive after the loop.
+  Node* ret = graph()->end()->InputAt(0);
+  ret->ReplaceInput(0, value);
+
+  RunLoopVectorizer();
+
+  EXPECT_FALSE(IsVectorized(l));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -86,6 +86,33 @@ class RegisterAllocatorTest : public InstructionSequenceTest {
     WireBlocks();
     Pipeline::AllocateRegistersForTesting(config(), sequence(), true);
   }
+
+  // Keeps many more values alive than there are registers, with calls in
+  // between, which forces lots of splitting and spilling.
+  void BuildManyValuesLiveAcrossCalls() {
+    const int kNumValues = 4 * kDefaultNRegs;
+    VReg values[kNumValues];
+    StartBlock();
+    for (int i = 0; i < kNumValues; ++i) {
+      values[i] = EmitOI(Reg());
+      if (i % kDefaultNRegs == 0) EmitCall(Slot(-1));
+    }
+    EndBlock(Branch(Reg(values[0]), 1, 2));
+
+    StartBlock(true);
+    EmitCall(Slot(-1), Slot(values[1]));
+    EndBlock(Jump(2));
+
+    StartBlock();
+    EndBlock(FallThrough());
+
+    StartBlock();
+    for (int i = 0; i < kNumValues; ++i) {
+      EmitOI(Reg(), Reg(values[i]), Reg(values[kNumValues - 1 - i]));
+    }
+    Return(Reg(values[0]));
+    EndBlock();
+  }
 };
 
 
@@ -700,6 +727,21 @@ TEST_F(RegisterAllocatorTest, MultipleDeferredBlockSpills) {
 }
 
 
+TEST_F(RegisterAllocatorTest, ManyValuesLiveAcrossCalls) {
+  BuildManyValuesLiveAcrossCalls();
+  Allocate();
+}
+
+
+TEST_F(RegisterAllocatorTest, ManyValuesLiveAcrossCallsInFastMode) {
+  int const threshold = FLAG_turbo_fast_register_allocation_threshold;
+  FLAG_turbo_fast_register_allocation_threshold = 0;
+  BuildManyValuesLiveAcrossCalls();
+  Allocate();
+  FLAG_turbo_fast_register_allocation_threshold = threshold;
+}
+
+
 namespace {
 
 enum class ParameterType { kFixedSlot, kSlot, kRegister, kFixedRegister };
@@ -1334,6 +1334,60 @@ TEST_F(InstructionSelectorTest, Word32Clz) {
   EXPECT_EQ(s.ToVreg(n), s.ToVreg(s[0]->Output()));
 }
 
+
+// -----------------------------------------------------------------------------
+// SIMD.
+
+
+TEST_F(InstructionSelectorTest, Float32x4AddWithLoadsAndStore) {
+  StreamBuilder m(this, MachineType::Int32(), MachineType::Pointer(),
+                  MachineType::Int32());
+  Node* const p0 = m.Parameter(0);
+  Node* const p1 = m.Parameter(1);
+  Node* const a = m.Load(MachineType::Simd128(), p0, p1);
+  Node* const b = m.Load(MachineType::Simd128(), p0, m.Int32Constant(16));
+  Node* const n = m.AddNode(m.machine()->Float32x4Add(), a, b);
+  m.Store(MachineRepresentation::kSimd128, p0, m.Int32Constant(32), n,
+          kNoWriteBarrier);
+  m.Return(m.Int32Constant(0));
+  Stream s = m.Build();
+  ASSERT_EQ(4U, s.size());
+  EXPECT_EQ(kX64Movups, s[0]->arch_opcode());
+  EXPECT_EQ(kX64Movups, s[1]->arch_opcode());
+  EXPECT_EQ(kSSEFloat32x4Add, s[2]->arch_opcode());
+  ASSERT_EQ(2U, s[2]->InputCount());
+  EXPECT_EQ(s.ToVreg(a), s.ToVreg(s[2]->InputAt(0)));
+  EXPECT_EQ(s.ToVreg(b), s.ToVreg(s[2]->InputAt(1)));
+  ASSERT_EQ(1U, s[2]->OutputCount());
+  EXPECT_TRUE(s.IsSameAsFirst(s[2]->Output()));
+  EXPECT_EQ(kX64Movups, s[3]->arch_opcode());
+  EXPECT_EQ(0U, s[3]->OutputCount());
+}
+
+
+TEST_F(InstructionSelectorTest, Int32x4SplatAndShift) {
+  StreamBuilder m(this, MachineType::Int32(), MachineType::Pointer(),
+                  MachineType::Int32());
+  Node* const p0 = m.Parameter(0);
+  Node* const p1 = m.Parameter(1);
+  Node* const splat = m.AddNode(m.machine()->CreateInt32x4(), p1, p1, p1, p1);
+  Node* const n = m.AddNode(m.machine()->Int32x4ShiftLeftByScalar(), splat,
+                            m.Int32Constant(3));
+  m.Store(MachineRepresentation::kSimd128, p0, m.Int32Constant(0), n,
+          kNoWriteBarrier);
+  m.Return(m.Int32Constant(0));
+  Stream s = m.Build();
+  ASSERT_EQ(3U, s.size());
+  EXPECT_EQ(kSSEInt32x4Splat, s[0]->arch_opcode());
+  ASSERT_EQ(1U, s[0]->InputCount());
+  EXPECT_EQ(s.ToVreg(p1), s.ToVreg(s[0]->InputAt(0)));
+  EXPECT_EQ(kSSEInt32x4ShiftLeftByScalar, s[1]->arch_opcode());
+  ASSERT_EQ(2U, s[1]->InputCount());
+  EXPECT_EQ(3, s.ToInt32(s[1]->InputAt(1)));
+  EXPECT_TRUE(s.IsSameAsFirst(s[1]->Output()));
+  EXPECT_EQ(kX64Movups, s[2]->arch_opcode());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
@@ -405,6 +405,16 @@ TEST_F(BytecodeArrayBuilderTest, AllBytecodesGenerated) {
   // Insert entry for nop bytecode as this often gets optimized out.
   scorecard[Bytecodes::ToByte(Bytecode::kNop)] = 1;
 
+  if (!FLAG_ignition_short_bytecodes) {
+    // Insert entries for bytecodes only emitted with short-form encoding.
+    for (int i = 0; i < Bytecodes::kShortFormRegisterCount; ++i) {
+      scorecard[Bytecodes::ToByte(
+          Bytecodes::GetShortForm(Bytecode::kStar, i))] = 1;
+      scorecard[Bytecodes::ToByte(
+          Bytecodes::GetShortForm(Bytecode::kLdar, i))] = 1;
+    }
+  }
+
   if (!FLAG_ignition_peephole) {
     // Insert entries for bytecodes only emitted by peephole optimizer.
     scorecard[Bytecodes::ToByte(Bytecode::kLdrNamedProperty)] = 1;
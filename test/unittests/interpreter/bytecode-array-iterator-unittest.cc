@@ -278,6 +278,61 @@ TEST_F(BytecodeArrayIteratorTest, IteratesBytecodeArray) {
   CHECK(iterator.done());
 }
 
+TEST_F(BytecodeArrayIteratorTest, ShortFormRegisterTransfers) {
+  bool old_flag = FLAG_ignition_short_bytecodes;
+  FLAG_ignition_short_bytecodes = true;
+
+  BytecodeArrayBuilder builder(isolate(), zone(), 0, 0, 20);
+  Register reg_3(3);
+  Register reg_19(19);
+
+  builder.LoadLiteral(Smi::FromInt(1))
+      .StoreAccumulatorInRegister(reg_3)
+      .LoadLiteral(Smi::FromInt(2))
+      .StoreAccumulatorInRegister(reg_19)
+      .LoadAccumulatorWithRegister(reg_3)
+      .Return();
+
+  BytecodeArrayIterator iterator(builder.ToBytecodeArray());
+  int offset = 0;
+
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kLdaSmi);
+  offset += Bytecodes::Size(Bytecode::kLdaSmi, OperandScale::kSingle);
+  iterator.Advance();
+
+  CHECK_EQ(iterator.current_raw_bytecode(), Bytecode::kStar3);
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kStar);
+  CHECK_EQ(iterator.current_offset(), offset);
+  CHECK_EQ(iterator.current_bytecode_size(), 1);
+  CHECK_EQ(iterator.GetRegisterOperand(0).index(), reg_3.index());
+  CHECK_EQ(iterator.GetRegisterOperandRange(0), 1);
+  offset += Bytecodes::Size(Bytecode::kStar3, OperandScale::kSingle);
+  iterator.Advance();
+
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kLdaSmi);
+  offset += Bytecodes::Size(Bytecode::kLdaSmi, OperandScale::kSingle);
+  iterator.Advance();
+
+  CHECK_EQ(iterator.current_raw_bytecode(), Bytecode::kStar);
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kStar);
+  CHECK_EQ(iterator.current_offset(), offset);
+  CHECK_EQ(iterator.GetRegisterOperand(0).index(), reg_19.index());
+  offset += Bytecodes::Size(Bytecode::kStar, OperandScale::kSingle);
+  iterator.Advance();
+
+  CHECK_EQ(iterator.current_raw_bytecode(), Bytecode::kLdar3);
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kLdar);
+  CHECK_EQ(iterator.current_offset(), offset);
+  CHECK_EQ(iterator.GetRegisterOperand(0).index(), reg_3.index());
+  iterator.Advance();
+
+  CHECK_EQ(iterator.current_bytecode(), Bytecode::kReturn);
+  iterator.Advance();
+  CHECK(iterator.done());
+
+  FLAG_ignition_short_bytecodes = old_flag;
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -155,6 +155,40 @@ TEST_F(BytecodeArrayWriterUnittest, SimpleExample) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, ShortFormRegisterTransfers) {
+  bool old_flag = FLAG_ignition_short_bytecodes;
+  FLAG_ignition_short_bytecodes = true;
+
+  Write(Bytecode::kStar, Register(3).ToOperand());
+  CHECK_EQ(bytecodes()->size(), 1);
+  CHECK_EQ(max_register_count(), 4);
+
+  Write(Bytecode::kLdar, Register(15).ToOperand());
+  CHECK_EQ(bytecodes()->size(), 2);
+  CHECK_EQ(max_register_count(), 16);
+
+  // Registers without a short form keep the register operand.
+  Write(Bytecode::kStar, Register(16).ToOperand());
+  CHECK_EQ(bytecodes()->size(), 4);
+  CHECK_EQ(max_register_count(), 17);
+
+  Write(Bytecode::kLdar, Register(200).ToOperand());
+  CHECK_EQ(bytecodes()->size(), 8);
+  CHECK_EQ(max_register_count(), 201);
+
+  Write(Bytecode::kReturn);
+  CHECK_EQ(bytecodes()->size(), 9);
+
+  static const uint8_t bytes[] = {B(Star3), B(Ldar15), B(Star),   R8(16),
+                                  B(Wide),  B(Ldar),   R16(200), B(Return)};
+  CHECK_EQ(bytecodes()->size(), arraysize(bytes));
+  for (size_t i = 0; i < arraysize(bytes); ++i) {
+    CHECK_EQ(bytecodes()->at(i), bytes[i]);
+  }
+
+  FLAG_ignition_short_bytecodes = old_flag;
+}
+
 TEST_F(BytecodeArrayWriterUnittest, ComplexExample) {
   static const uint8_t expected_bytes[] = {
       // clang-format off
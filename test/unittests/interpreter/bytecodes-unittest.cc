@@ -161,6 +161,32 @@ TEST(Bytecodes, PrefixMappings) {
   }
 }
 
+TEST(Bytecodes, ShortForms) {
+  for (int i = 0; i < Bytecodes::kShortFormRegisterCount; ++i) {
+    Bytecode short_star = Bytecodes::GetShortForm(Bytecode::kStar, i);
+    CHECK(Bytecodes::IsShortStar(short_star));
+    CHECK(!Bytecodes::IsShortLdar(short_star));
+    CHECK_EQ(Bytecodes::GetLongForm(short_star), Bytecode::kStar);
+    CHECK_EQ(Bytecodes::GetShortFormRegisterIndex(short_star), i);
+    CHECK_EQ(Bytecodes::Size(short_star, OperandScale::kSingle), 1);
+
+    Bytecode short_ldar = Bytecodes::GetShortForm(Bytecode::kLdar, i);
+    CHECK(Bytecodes::IsShortLdar(short_ldar));
+    CHECK(!Bytecodes::IsShortStar(short_ldar));
+    CHECK_EQ(Bytecodes::GetLongForm(short_ldar), Bytecode::kLdar);
+    CHECK_EQ(Bytecodes::GetShortFormRegisterIndex(short_ldar), i);
+    CHECK_EQ(Bytecodes::Size(short_ldar, OperandScale::kSingle), 1);
+  }
+  CHECK_EQ(Bytecodes::GetShortForm(Bytecode::kStar, 0), Bytecode::kStar0);
+  CHECK_EQ(Bytecodes::GetShortForm(Bytecode::kLdar, 15), Bytecode::kLdar15);
+  CHECK(!Bytecodes::HasShortForm(Bytecode::kStar, -1));
+  CHECK(!Bytecodes::HasShortForm(Bytecode::kStar,
+                                 Bytecodes::kShortFormRegisterCount));
+  CHECK(!Bytecodes::HasShortForm(Bytecode::kMov, 0));
+  CHECK(!Bytecodes::IsShortForm(Bytecode::kStar));
+  CHECK(!Bytecodes::IsShortForm(Bytecode::kLdar));
+}
+
 TEST(Bytecodes, SizesForSignedOperands) {
   CHECK(Bytecodes::SizeForSignedOperand(0) == OperandSize::kByte);
   CHECK(Bytecodes::SizeForSignedOperand(kMaxInt8) == OperandSize::kByte);
@@ -342,6 +342,19 @@ TARGET_TEST_F(InterpreterAssemblerTest, Dispatch) {
                    IsParameter(InterpreterDispatchDescriptor::kDispatchTable),
                    IsWordShl(target_bytecode_matcher,
                              IsIntPtrConstant(kPointerSizeLog2)));
+    } else if (interpreter::Bytecodes::IsConditionalJumpLookahead(
+                   bytecode, operand_scale)) {
+      // Falls through to dispatch, or inlines JumpIfTrue or JumpIfFalse.
+      next_bytecode_offset_matcher =
+          IsPhi(MachineType::PointerRepresentation(),
+                next_bytecode_offset_matcher, _, _, _);
+      target_bytecode_matcher = IsPhi(MachineRepresentation::kWord8,
+                                      target_bytecode_matcher, _, _, _);
+      code_target_matcher =
+          m.IsLoad(MachineType::Pointer(),
+                   IsParameter(InterpreterDispatchDescriptor::kDispatchTable),
+                   IsWordShl(target_bytecode_matcher,
+                             IsIntPtrConstant(kPointerSizeLog2)));
     }
 
     EXPECT_THAT(
@@ -8,6 +8,7 @@
   'variables': {
     'v8_code': 1,
     'unittests_sources': [  ### gcmole(all) ###
+      'base/accounting-allocator-unittest.cc',
       'base/atomic-utils-unittest.cc',
       'base/bits-unittest.cc',
       'base/cpu-unittest.cc',
@@ -26,6 +27,7 @@
       'base/utils/random-number-generator-unittest.cc',
       'cancelable-tasks-unittest.cc',
       'char-predicates-unittest.cc',
+      'compiler/bounds-check-elimination-unittest.cc',
       'compiler/branch-elimination-unittest.cc',
       'compiler/checkpoint-elimination-unittest.cc',
       'compiler/common-operator-reducer-unittest.cc',
@@ -42,6 +44,7 @@
       'compiler/graph-trimmer-unittest.cc',
       'compiler/graph-unittest.cc',
       'compiler/graph-unittest.h',
+      'compiler/instruction-scheduler-unittest.cc',
       'compiler/instruction-selector-unittest.cc',
       'compiler/instruction-selector-unittest.h',
       'compiler/instruction-sequence-unittest.cc',
@@ -56,7 +59,9 @@
       'compiler/liveness-analyzer-unittest.cc',
       'compiler/live-range-unittest.cc',
       'compiler/load-elimination-unittest.cc',
+      'compiler/loop-invariant-code-motion-unittest.cc',
       'compiler/loop-peeling-unittest.cc',
+      'compiler/loop-vectorizer-unittest.cc',
       'compiler/machine-operator-reducer-unittest.cc',
       'compiler/machine-operator-unittest.cc',
       'compiler/move-optimizer-unittest.cc',
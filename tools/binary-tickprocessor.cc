@@ -0,0 +1,394 @@
+// Copyright 2016 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Processes the binary profile written by d8 --prof-binary (<logfile>.bin)
+// into the flat and bottom up (heavy) profiles that tools/tickprocessor.js
+// prints for text logs. The tool has no dependencies on V8 and streams the
+// log in one pass, so it copes with logs of several gigabytes.
+//
+// C++ symbols are not resolved: ticks in shared libraries are attributed to
+// the library as a whole.
+//
+// Usage: v8_binary_tickprocessor [--call-graph-size=<n>] [v8.log.bin]
+
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+// The record layout must match BinaryProfLogger in src/log.cc.
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+};
+
+struct CodeCreateStruct {
+  uint64_t code_address;
+  uint32_t code_size;
+  uint32_t name_size;
+};
+
+struct CodeMoveStruct {
+  uint64_t from_address;
+  uint64_t to_address;
+};
+
+struct SharedLibraryStruct {
+  uint64_t start;
+  uint64_t end;
+  int64_t aslr_slide;
+  uint32_t name_size;
+  uint32_t reserved;
+};
+
+struct TickStruct {
+  uint64_t pc;
+  uint64_t tos_or_external_callback;
+  uint32_t time_us;
+  uint8_t vm_state;
+  uint8_t has_external_callback;
+  uint8_t overflow;
+  uint8_t frames_count;
+};
+
+const uint32_t kVersion = 1;
+const uint8_t kGCState = 1;  // StateTag GC in include/v8.h.
+const double kCallProfileCutoffPct = 1.0;
+const int kNoEntry = -1;
+
+struct CodeEntry {
+  uint64_t size;
+  int name;
+};
+
+struct Library {
+  uint64_t start;
+  uint64_t end;
+  int name;
+};
+
+struct HeavyNode {
+  explicit HeavyNode(int name) : name(name), total(0) {}
+  HeavyNode* Child(int child_name) {
+    std::unique_ptr<HeavyNode>& child = children[child_name];
+    if (!child) child.reset(new HeavyNode(child_name));
+    return child.get();
+  }
+
+  int name;
+  int total;
+  std::map<int, std::unique_ptr<HeavyNode>> children;
+};
+
+class Processor {
+ public:
+  Processor() : heavy_root_(kNoEntry) {}
+
+  bool Process(FILE* log);
+  void PrintStatistics(const char* file_name, int call_graph_size);
+
+ private:
+  int Intern(const char* chars, size_t length);
+  void AddCode(uint64_t start, uint64_t size, int name);
+  void MoveCode(uint64_t from, uint64_t to);
+  int FindEntry(uint64_t address);
+  void RecordTick(const TickStruct& tick, const uint64_t* frames);
+
+  void PrintLine(const std::string& name, int ticks, int total,
+                 int nonlib) const;
+  void PrintHeavy(const HeavyNode* node, int indent, int call_graph_size);
+  std::vector<const HeavyNode*> SortedChildren(const HeavyNode* node) const;
+
+  std::vector<std::string> names_;
+  std::unordered_map<std::string, int> name_ids_;
+  std::vector<bool> is_library_;
+
+  std::map<uint64_t, CodeEntry> code_map_;
+  std::vector<Library> libraries_;
+
+  std::vector<int> self_ticks_;
+  HeavyNode heavy_root_;
+  int total_ticks_ = 0;
+  int gc_ticks_ = 0;
+  int unaccounted_ticks_ = 0;
+};
+
+int Processor::Intern(const char* chars, size_t length) {
+  std::string name(chars, length);
+  auto it = name_ids_.find(name);
+  if (it != name_ids_.end()) return it->second;
+  int id = static_cast<int>(names_.size());
+  names_.push_back(name);
+  name_ids_[name] = id;
+  is_library_.push_back(false);
+  self_ticks_.push_back(0);
+  return id;
+}
+
+void Processor::AddCode(uint64_t start, uint64_t size, int name) {
+  // Remove entries overlapping the new one, their code is dead.
+  uint64_t end = start + std::max<uint64_t>(size, 1);
+  auto it = code_map_.lower_bound(start);
+  if (it != code_map_.begin()) {
+    auto prev = std::prev(it);
+    if (prev->first + prev->second.size > start) it = prev;
+  }
+  while (it != code_map_.end() && it->first < end) it = code_map_.erase(it);
+  code_map_[start] = {size, name};
+}
+
+void Processor::MoveCode(uint64_t from, uint64_t to) {
+  auto it = code_map_.find(from);
+  if (it == code_map_.end()) return;
+  CodeEntry entry = it->second;
+  code_map_.erase(it);
+  AddCode(to, entry.size, entry.name);
+}
+
+int Processor::FindEntry(uint64_t address) {
+  auto it = code_map_.upper_bound(address);
+  if (it != code_map_.begin()) {
+    --it;
+    if (address < it->first + std::max<uint64_t>(it->second.size, 1)) {
+      return it->second.name;
+    }
+  }
+  for (const Library& library : libraries_) {
+    if (address >= library.start && address < library.end) {
+      return library.name;
+    }
+  }
+  return kNoEntry;
+}
+
+void Processor::RecordTick(const TickStruct& tick, const uint64_t* frames) {
+  total_ticks_++;
+  if (tick.vm_state == kGCState) gc_ticks_++;
+
+  // Don't use the pc when in external callback code, as it can point inside
+  // the callback's code. Use the callback entry instead.
+  uint64_t pc =
+      tick.has_external_callback ? tick.tos_or_external_callback : tick.pc;
+  int top = FindEntry(pc);
+  if (top == kNoEntry) {
+    unaccounted_ticks_++;
+    return;
+  }
+  self_ticks_[top]++;
+
+  HeavyNode* node = heavy_root_.Child(top);
+  node->total++;
+  int previous = top;
+  for (int i = 0; i < tick.frames_count; i++) {
+    int caller = FindEntry(frames[i]);
+    // Skip unresolved frames and direct recursion.
+    if (caller == kNoEntry || caller == previous) continue;
+    node = node->Child(caller);
+    node->total++;
+    previous = caller;
+  }
+}
+
+// Reads exactly |size| bytes, or fails at the end of the log.
+bool ReadBytes(FILE* log, void* buffer, size_t size) {
+  return size == 0 || fread(buffer, 1, size, log) == size;
+}
+
+bool Processor::Process(FILE* log) {
+  FileHeader header;
+  if (!ReadBytes(log, &header, sizeof(header))) return false;
+  if (memcmp(header.magic, "V8PB", 4) != 0 || header.version != kVersion) {
+    fprintf(stderr, "Not a binary V8 profile (version %u).\n", kVersion);
+    return false;
+  }
+
+  std::vector<char> name;
+  std::vector<uint64_t> frames;
+  int tag;
+  while ((tag = fgetc(log)) != EOF) {
+    switch (tag) {
+      case 'C': {
+        CodeCreateStruct event;
+        if (!ReadBytes(log, &event, sizeof(event))) return false;
+        name.resize(event.name_size);
+        if (!ReadBytes(log, name.data(), name.size())) return false;
+        AddCode(event.code_address, event.code_size,
+                Intern(name.data(), name.size()));
+        break;
+      }
+      case 'M': {
+        CodeMoveStruct event;
+        if (!ReadBytes(log, &event, sizeof(event))) return false;
+        MoveCode(event.from_address, event.to_address);
+        break;
+      }
+      case 'L': {
+        SharedLibraryStruct event;
+        if (!ReadBytes(log, &event, sizeof(event))) return false;
+        name.resize(event.name_size);
+        if (!ReadBytes(log, name.data(), name.size())) return false;
+        int id = Intern(name.data(), name.size());
+        is_library_[id] = true;
+        libraries_.push_back({event.start, event.end, id});
+        break;
+      }
+      case 'T': {
+        TickStruct event;
+        if (!ReadBytes(log, &event, sizeof(event))) return false;
+        frames.resize(event.frames_count);
+        if (!ReadBytes(log, frames.data(),
+                       frames.size() * sizeof(frames[0]))) {
+          return false;
+        }
+        RecordTick(event, frames.data());
+        break;
+      }
+      default:
+        fprintf(stderr, "Unknown record '%c' at offset %ld.\n", tag,
+                ftell(log) - 1);
+        return false;
+    }
+  }
+  return !ferror(log);
+}
+
+void Processor::PrintLine(const std::string& name, int ticks, int total,
+                          int nonlib) const {
+  printf("  %5d  %5.1f%%  ", ticks, ticks * 100.0 / total);
+  if (nonlib > 0) {
+    printf("%5.1f%%  ", ticks * 100.0 / nonlib);
+  } else {
+    printf("        ");
+  }
+  printf("%s\n", name.c_str());
+}
+
+std::vector<const HeavyNode*> Processor::SortedChildren(
+    const HeavyNode* node) const {
+  std::vector<const HeavyNode*> children;
+  for (const auto& child : node->children) {
+    children.push_back(child.second.get());
+  }
+  std::sort(children.begin(), children.end(),
+            [this](const HeavyNode* a, const HeavyNode* b) {
+              if (a->total != b->total) return a->total > b->total;
+              return names_[a->name] > names_[b->name];
+            });
+  return children;
+}
+
+void Processor::PrintHeavy(const HeavyNode* node, int indent,
+                           int call_graph_size) {
+  int parent_total = node == &heavy_root_ ? total_ticks_ : node->total;
+  for (const HeavyNode* child : SortedChildren(node)) {
+    double parent_pct = child->total * 100.0 / parent_total;
+    // Cut off too infrequent callers.
+    if (parent_pct < kCallProfileCutoffPct) continue;
+    printf("  %5d  %5.1f%%  %*s%s\n", child->total, parent_pct, indent, "",
+           names_[child->name].c_str());
+    // Limit backtrace depth.
+    if (indent < 2 * call_graph_size) {
+      PrintHeavy(child, indent + 2, call_graph_size);
+    }
+    // Delimit top-level functions.
+    if (indent == 0) printf("\n");
+  }
+}
+
+void Processor::PrintStatistics(const char* file_name, int call_graph_size) {
+  printf(
+      "Statistical profiling result from %s, (%d ticks, %d unaccounted, 0 "
+      "excluded).\n",
+      file_name, total_ticks_, unaccounted_ticks_);
+  if (total_ticks_ == 0) return;
+
+  // Sort by self time, desc, then by name, desc.
+  std::vector<int> flat;
+  for (int i = 0; i < static_cast<int>(names_.size()); i++) {
+    if (self_ticks_[i] > 0) flat.push_back(i);
+  }
+  std::sort(flat.begin(), flat.end(), [this](int a, int b) {
+    if (self_ticks_[a] != self_ticks_[b]) {
+      return self_ticks_[a] > self_ticks_[b];
+    }
+    return names_[a] > names_[b];
+  });
+
+  int library_ticks = 0;
+  printf("\n [Shared libraries]:\n   ticks  total  nonlib   name\n");
+  for (int name : flat) {
+    if (!is_library_[name]) continue;
+    library_ticks += self_ticks_[name];
+    PrintLine(names_[name], self_ticks_[name], total_ticks_, 0);
+  }
+  int nonlib_ticks = total_ticks_ - library_ticks;
+
+  int js_ticks = 0;
+  printf("\n [JavaScript]:\n   ticks  total  nonlib   name\n");
+  for (int name : flat) {
+    if (is_library_[name]) continue;
+    js_ticks += self_ticks_[name];
+    PrintLine(names_[name], self_ticks_[name], total_ticks_, nonlib_ticks);
+  }
+
+  printf("\n [Summary]:\n   ticks  total  nonlib   name\n");
+  PrintLine("JavaScript", js_ticks, total_ticks_, nonlib_ticks);
+  PrintLine("GC", gc_ticks_, total_ticks_, nonlib_ticks);
+  PrintLine("Shared libraries", library_ticks, total_ticks_, 0);
+  if (unaccounted_ticks_ > 0) {
+    PrintLine("Unaccounted", unaccounted_ticks_, total_ticks_, 0);
+  }
+
+  printf(
+      "\n [Bottom up (heavy) profile]:\n"
+      "  Note: percentage shows a share of a particular caller in the total\n"
+      "  amount of its parent calls.\n"
+      "  Callers occupying less than %.1f%% are not shown.\n\n"
+      "   ticks parent  name\n",
+      kCallProfileCutoffPct);
+  PrintHeavy(&heavy_root_, 0, call_graph_size);
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  const char* file_name = "v8.log.bin";
+  int call_graph_size = 5;
+  for (int i = 1; i < argc; i++) {
+    if (strncmp(argv[i], "--call-graph-size=", 18) == 0) {
+      call_graph_size = atoi(argv[i] + 18);
+    } else if (argv[i][0] == '-') {
+      fprintf(stderr,
+              "Usage: %s [--call-graph-size=<n>] [v8.log.bin]\n", argv[0]);
+      return 1;
+    } else {
+      file_name = argv[i];
+    }
+  }
+
+  FILE* log = fopen(file_name, "rb");
+  if (log == nullptr) {
+    fprintf(stderr, "Cannot read %s.\n", file_name);
+    return 1;
+  }
+  Processor processor;
+  bool processed = processor.Process(log);
+  fclose(log);
+  if (!processed) {
+    fprintf(stderr, "Malformed binary profile %s.\n", file_name);
+    return 1;
+  }
+  processor.PrintStatistics(file_name, call_graph_size);
+  return 0;
+}
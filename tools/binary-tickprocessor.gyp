@@ -0,0 +1,20 @@
+# Copyright 2016 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+{
+  'variables': {
+    'v8_code': 1,
+  },
+  'includes': ['../gypfiles/toolchain.gypi', '../gypfiles/features.gypi'],
+  'targets': [
+    {
+      # Processor for profiles written with --prof-binary. It does not link V8.
+      'target_name': 'binary-tickprocessor',
+      'type': 'executable',
+      'sources': [
+        'binary-tickprocessor.cc',
+      ],
+    },
+  ],
+}